@@ -40,6 +40,8 @@ enum ForwardsList
     Handle:OnClientValidateCostume,
     Handle:OnClientSkillUsed,
     Handle:OnClientSkillOver,
+    Handle:OnClientRespawnQueued,
+    Handle:OnClientRespawn,
     Handle:OnGrenadeCreated,
     Handle:OnWeaponCreated,
     Handle:OnWeaponRunCmd,
@@ -50,7 +52,8 @@ enum ForwardsList
     Handle:OnWeaponShoot,
     Handle:OnWeaponFire,
     Handle:OnZombieModStarted,
-    Handle:OnEngineExecute
+    Handle:OnEngineExecute,
+    Handle:OnConfigReloaded
 }
 
 /**
@@ -63,8 +66,8 @@ Handle gForwardsList[ForwardsList];
  **/
 void APIForwardsInit(/*void*/)
 {
-    gForwardsList[OnClientInfected]        = CreateGlobalForward("ZP_OnClientInfected", ET_Ignore, Param_Cell, Param_Cell, Param_Cell, Param_Cell);
-    gForwardsList[OnClientHumanized]       = CreateGlobalForward("ZP_OnClientHumanized", ET_Ignore, Param_Cell, Param_Cell, Param_Cell);
+    gForwardsList[OnClientInfected]        = CreateGlobalForward("ZP_OnClientInfected", ET_Ignore, Param_Cell, Param_Cell, Param_Cell, Param_Cell, Param_Cell);
+    gForwardsList[OnClientHumanized]       = CreateGlobalForward("ZP_OnClientHumanized", ET_Ignore, Param_Cell, Param_Cell, Param_Cell, Param_Cell);
     gForwardsList[OnClientDamaged]         = CreateGlobalForward("ZP_OnClientDamaged", ET_Ignore, Param_Cell, Param_Cell, Param_Cell, Param_FloatByRef, Param_Cell, Param_Cell);
     gForwardsList[OnClientValidateItem]    = CreateGlobalForward("ZP_OnClientValidateExtraItem", ET_Hook, Param_Cell, Param_Cell);
     gForwardsList[OnClientBuyItem]         = CreateGlobalForward("ZP_OnClientBuyExtraItem", ET_Ignore, Param_Cell, Param_Cell);
@@ -73,6 +76,8 @@ void APIForwardsInit(/*void*/)
     gForwardsList[OnClientValidateCostume] = CreateGlobalForward("ZP_OnClientValidateCostume", ET_Hook, Param_Cell, Param_Cell);
     gForwardsList[OnClientSkillUsed]       = CreateGlobalForward("ZP_OnClientSkillUsed", ET_Hook, Param_Cell);
     gForwardsList[OnClientSkillOver]       = CreateGlobalForward("ZP_OnClientSkillOver", ET_Ignore, Param_Cell);
+    gForwardsList[OnClientRespawnQueued]   = CreateGlobalForward("ZP_OnClientRespawnQueued", ET_Hook, Param_Cell, Param_FloatByRef);
+    gForwardsList[OnClientRespawn]         = CreateGlobalForward("ZP_OnClientRespawn", ET_Hook, Param_Cell);
     gForwardsList[OnGrenadeCreated]        = CreateGlobalForward("ZP_OnGrenadeCreated", ET_Ignore, Param_Cell, Param_Cell, Param_Cell);
     gForwardsList[OnWeaponCreated]         = CreateGlobalForward("ZP_OnWeaponCreated", ET_Ignore, Param_Cell, Param_Cell, Param_Cell);
     gForwardsList[OnWeaponRunCmd]          = CreateGlobalForward("ZP_OnWeaponRunCmd", ET_Hook, Param_Cell, Param_CellByRef, Param_Cell, Param_Cell, Param_Cell);
@@ -84,6 +89,33 @@ void APIForwardsInit(/*void*/)
     gForwardsList[OnWeaponFire]            = CreateGlobalForward("ZP_OnWeaponFire", ET_Ignore, Param_Cell, Param_Cell, Param_Cell);
     gForwardsList[OnZombieModStarted]      = CreateGlobalForward("ZP_OnZombieModStarted", ET_Ignore, Param_Cell);
     gForwardsList[OnEngineExecute]         = CreateGlobalForward("ZP_OnEngineExecute", ET_Ignore);
+    gForwardsList[OnConfigReloaded]        = CreateGlobalForward("ZP_OnConfigReloaded", ET_Ignore, Param_String, Param_Array, Param_Array, Param_Cell);
+
+    // Register names for the profiler
+    DebugProfileRegister(DEBUG_PROFILE_FORWARD(OnClientInfected),        "ZP_OnClientInfected");
+    DebugProfileRegister(DEBUG_PROFILE_FORWARD(OnClientHumanized),       "ZP_OnClientHumanized");
+    DebugProfileRegister(DEBUG_PROFILE_FORWARD(OnClientDamaged),         "ZP_OnClientDamaged");
+    DebugProfileRegister(DEBUG_PROFILE_FORWARD(OnClientValidateItem),    "ZP_OnClientValidateExtraItem");
+    DebugProfileRegister(DEBUG_PROFILE_FORWARD(OnClientBuyItem),         "ZP_OnClientBuyExtraItem");
+    DebugProfileRegister(DEBUG_PROFILE_FORWARD(OnClientValidateZombie),  "ZP_OnClientValidateZombieClass");
+    DebugProfileRegister(DEBUG_PROFILE_FORWARD(OnClientValidateHuman),   "ZP_OnClientValidateHumanClass");
+    DebugProfileRegister(DEBUG_PROFILE_FORWARD(OnClientValidateCostume), "ZP_OnClientValidateCostume");
+    DebugProfileRegister(DEBUG_PROFILE_FORWARD(OnClientSkillUsed),       "ZP_OnClientSkillUsed");
+    DebugProfileRegister(DEBUG_PROFILE_FORWARD(OnClientSkillOver),       "ZP_OnClientSkillOver");
+    DebugProfileRegister(DEBUG_PROFILE_FORWARD(OnClientRespawnQueued),   "ZP_OnClientRespawnQueued");
+    DebugProfileRegister(DEBUG_PROFILE_FORWARD(OnClientRespawn),         "ZP_OnClientRespawn");
+    DebugProfileRegister(DEBUG_PROFILE_FORWARD(OnGrenadeCreated),        "ZP_OnGrenadeCreated");
+    DebugProfileRegister(DEBUG_PROFILE_FORWARD(OnWeaponCreated),         "ZP_OnWeaponCreated");
+    DebugProfileRegister(DEBUG_PROFILE_FORWARD(OnWeaponRunCmd),          "ZP_OnWeaponRunCmd");
+    DebugProfileRegister(DEBUG_PROFILE_FORWARD(OnWeaponDeploy),          "ZP_OnWeaponDeploy");
+    DebugProfileRegister(DEBUG_PROFILE_FORWARD(OnWeaponHolster),         "ZP_OnWeaponHolster");
+    DebugProfileRegister(DEBUG_PROFILE_FORWARD(OnWeaponReload),          "ZP_OnWeaponReload");
+    DebugProfileRegister(DEBUG_PROFILE_FORWARD(OnWeaponBullet),          "ZP_OnWeaponBullet");
+    DebugProfileRegister(DEBUG_PROFILE_FORWARD(OnWeaponShoot),           "ZP_OnWeaponShoot");
+    DebugProfileRegister(DEBUG_PROFILE_FORWARD(OnWeaponFire),            "ZP_OnWeaponFire");
+    DebugProfileRegister(DEBUG_PROFILE_FORWARD(OnZombieModStarted),      "ZP_OnZombieModStarted");
+    DebugProfileRegister(DEBUG_PROFILE_FORWARD(OnEngineExecute),         "ZP_OnEngineExecute");
+    DebugProfileRegister(DEBUG_PROFILE_FORWARD(OnConfigReloaded),        "ZP_OnConfigReloaded");
 }
 
 /**
@@ -93,10 +125,12 @@ void APIForwardsInit(/*void*/)
  * @param attackerIndex     The attacker index.
  * @param nemesisMode       Indicates that client will be a nemesis.
  * @param respawnMode       Indicates that infection was on spawn.
+ * @param batchMode         Indicates that infection was a part of the batch.
  **/
-void API_OnClientInfected(const int victimIndex, const int attackerIndex, const bool nemesisMode = false, const bool respawnMode = false)
+void API_OnClientInfected(const int victimIndex, const int attackerIndex, const bool nemesisMode = false, const bool respawnMode = false, const bool batchMode = false)
 {
     // Start forward call
+    DEBUG_PROFILE_START(DEBUG_PROFILE_FORWARD(OnClientInfected));
     Call_StartForward(gForwardsList[OnClientInfected]);
 
     // Push the parameters
@@ -104,9 +138,11 @@ void API_OnClientInfected(const int victimIndex, const int attackerIndex, const
     Call_PushCell(attackerIndex);
     Call_PushCell(nemesisMode);
     Call_PushCell(respawnMode);
+    Call_PushCell(batchMode);
     
     // Finish the call
     Call_Finish();
+    DEBUG_PROFILE_STOP(DEBUG_PROFILE_FORWARD(OnClientInfected));
 }
 
 /**
@@ -115,19 +151,23 @@ void API_OnClientInfected(const int victimIndex, const int attackerIndex, const
  * @param clientIndex       The client index.
  * @param survivorMode      Indicates that client will be a survivor.
  * @param respawnMode       Indicates that humanizing was on spawn.
+ * @param batchMode         Indicates that humanizing was a part of the batch.
  **/
-void API_OnClientHumanized(const int clientIndex, const bool survivorMode = false, const bool respawnMode = false)
+void API_OnClientHumanized(const int clientIndex, const bool survivorMode = false, const bool respawnMode = false, const bool batchMode = false)
 {
     // Start forward call
+    DEBUG_PROFILE_START(DEBUG_PROFILE_FORWARD(OnClientHumanized));
     Call_StartForward(gForwardsList[OnClientHumanized]);
 
     // Push the parameters
     Call_PushCell(clientIndex);
     Call_PushCell(survivorMode);
     Call_PushCell(respawnMode);
+    Call_PushCell(batchMode);
 
     // Finish the call
     Call_Finish();
+    DEBUG_PROFILE_STOP(DEBUG_PROFILE_FORWARD(OnClientHumanized));
 }
 
 /**
@@ -143,6 +183,7 @@ void API_OnClientHumanized(const int clientIndex, const bool survivorMode = fals
 void API_OnClientDamaged(const int victimIndex, const int attackerIndex, const int inflictorIndex, float &damageAmount, const int damageType, const int weaponIndex)
 {
     // Start forward call
+    DEBUG_PROFILE_START(DEBUG_PROFILE_FORWARD(OnClientDamaged));
     Call_StartForward(gForwardsList[OnClientDamaged]);
 
     // Push the parameters
@@ -155,6 +196,7 @@ void API_OnClientDamaged(const int victimIndex, const int attackerIndex, const i
     
     // Finish the call
     Call_Finish();
+    DEBUG_PROFILE_STOP(DEBUG_PROFILE_FORWARD(OnClientDamaged));
 }
 
 /**
@@ -172,6 +214,7 @@ Action API_OnClientValidateExtraItem(const int clientIndex, const int itemIndex)
     static Action resultHandle;
     
     // Start forward call
+    DEBUG_PROFILE_START(DEBUG_PROFILE_FORWARD(OnClientValidateItem));
     Call_StartForward(gForwardsList[OnClientValidateItem]);
     
     // Push the parameters
@@ -180,6 +223,7 @@ Action API_OnClientValidateExtraItem(const int clientIndex, const int itemIndex)
     
     // Finish the call
     Call_Finish(resultHandle);
+    DEBUG_PROFILE_STOP(DEBUG_PROFILE_FORWARD(OnClientValidateItem));
     
     // Return result
     return resultHandle;
@@ -197,6 +241,7 @@ Action API_OnClientValidateExtraItem(const int clientIndex, const int itemIndex)
 void API_OnClientBuyExtraItem(const int clientIndex, const int itemIndex)
 {
     // Start forward call
+    DEBUG_PROFILE_START(DEBUG_PROFILE_FORWARD(OnClientBuyItem));
     Call_StartForward(gForwardsList[OnClientBuyItem]);
     
     // Push the parameters
@@ -205,6 +250,7 @@ void API_OnClientBuyExtraItem(const int clientIndex, const int itemIndex)
     
     // Finish the call
     Call_Finish();
+    DEBUG_PROFILE_STOP(DEBUG_PROFILE_FORWARD(OnClientBuyItem));
 }
 
 /**
@@ -222,6 +268,7 @@ Action API_OnClientValidateZombieClass(const int clientIndex, const int classInd
     static Action resultHandle;
     
     // Start forward call
+    DEBUG_PROFILE_START(DEBUG_PROFILE_FORWARD(OnClientValidateZombie));
     Call_StartForward(gForwardsList[OnClientValidateZombie]);
     
     // Push the parameters
@@ -230,6 +277,7 @@ Action API_OnClientValidateZombieClass(const int clientIndex, const int classInd
     
     // Finish the call
     Call_Finish(resultHandle);
+    DEBUG_PROFILE_STOP(DEBUG_PROFILE_FORWARD(OnClientValidateZombie));
     
     // Return result
     return resultHandle;
@@ -250,6 +298,7 @@ Action API_OnClientValidateHumanClass(const int clientIndex, const int classInde
     static Action resultHandle;
     
     // Start forward call
+    DEBUG_PROFILE_START(DEBUG_PROFILE_FORWARD(OnClientValidateHuman));
     Call_StartForward(gForwardsList[OnClientValidateHuman]);
     
     // Push the parameters
@@ -258,6 +307,7 @@ Action API_OnClientValidateHumanClass(const int clientIndex, const int classInde
     
     // Finish the call
     Call_Finish(resultHandle);
+    DEBUG_PROFILE_STOP(DEBUG_PROFILE_FORWARD(OnClientValidateHuman));
     
     // Return result
     return resultHandle;
@@ -278,6 +328,7 @@ Action API_OnClientValidateCostume(const int clientIndex, const int costumeIndex
     static Action resultHandle;
     
     // Start forward call
+    DEBUG_PROFILE_START(DEBUG_PROFILE_FORWARD(OnClientValidateCostume));
     Call_StartForward(gForwardsList[OnClientValidateCostume]);
     
     // Push the parameters
@@ -286,6 +337,7 @@ Action API_OnClientValidateCostume(const int clientIndex, const int costumeIndex
     
     // Finish the call
     Call_Finish(resultHandle);
+    DEBUG_PROFILE_STOP(DEBUG_PROFILE_FORWARD(OnClientValidateCostume));
     
     // Return result
     return resultHandle;
@@ -305,6 +357,7 @@ Action API_OnClientSkillUsed(const int clientIndex)
     static Action resultHandle;
 
     // Start forward call
+    DEBUG_PROFILE_START(DEBUG_PROFILE_FORWARD(OnClientSkillUsed));
     Call_StartForward(gForwardsList[OnClientSkillUsed]);
 
     // Push the parameters
@@ -312,6 +365,7 @@ Action API_OnClientSkillUsed(const int clientIndex)
 
     // Finish the call
     Call_Finish(resultHandle);
+    DEBUG_PROFILE_STOP(DEBUG_PROFILE_FORWARD(OnClientSkillUsed));
     
     // Return result
     return resultHandle;
@@ -325,6 +379,7 @@ Action API_OnClientSkillUsed(const int clientIndex)
 void API_OnClientSkillOver(const int clientIndex)
 {
     // Start forward call
+    DEBUG_PROFILE_START(DEBUG_PROFILE_FORWARD(OnClientSkillOver));
     Call_StartForward(gForwardsList[OnClientSkillOver]);
 
     // Push the parameters
@@ -332,6 +387,65 @@ void API_OnClientSkillOver(const int clientIndex)
     
     // Finish the call
     Call_Finish();
+    DEBUG_PROFILE_STOP(DEBUG_PROFILE_FORWARD(OnClientSkillOver));
+}
+
+/**
+ * Called when a client respawn is queued.
+ * 
+ * @param clientIndex       The client index.
+ * @param flDelay           The delay in seconds.
+ *
+ * @return                  Plugin_Handled or Plugin_Stop to block respawn. Anything else
+ *                                (like Plugin_Continue) to allow respawn.
+ **/
+Action API_OnClientRespawnQueued(const int clientIndex, float &flDelay)
+{
+    // Initialize future result
+    static Action resultHandle;
+
+    // Start forward call
+    DEBUG_PROFILE_START(DEBUG_PROFILE_FORWARD(OnClientRespawnQueued));
+    Call_StartForward(gForwardsList[OnClientRespawnQueued]);
+
+    // Push the parameters
+    Call_PushCell(clientIndex);
+    Call_PushFloatRef(flDelay);
+
+    // Finish the call
+    Call_Finish(resultHandle);
+    DEBUG_PROFILE_STOP(DEBUG_PROFILE_FORWARD(OnClientRespawnQueued));
+    
+    // Return result
+    return resultHandle;
+}
+
+/**
+ * Called when a queued client respawn is due.
+ * 
+ * @param clientIndex       The client index.
+ *
+ * @return                  Plugin_Handled to defer respawn, Plugin_Stop to drop respawn. Anything else
+ *                                (like Plugin_Continue) to allow respawn.
+ **/
+Action API_OnClientRespawn(const int clientIndex)
+{
+    // Initialize future result
+    static Action resultHandle;
+
+    // Start forward call
+    DEBUG_PROFILE_START(DEBUG_PROFILE_FORWARD(OnClientRespawn));
+    Call_StartForward(gForwardsList[OnClientRespawn]);
+
+    // Push the parameters
+    Call_PushCell(clientIndex);
+
+    // Finish the call
+    Call_Finish(resultHandle);
+    DEBUG_PROFILE_STOP(DEBUG_PROFILE_FORWARD(OnClientRespawn));
+    
+    // Return result
+    return resultHandle;
 }
 
 /**
@@ -344,6 +458,7 @@ void API_OnClientSkillOver(const int clientIndex)
 void API_OnGrenadeCreated(const int clientIndex, const int grenadeIndex, const int weaponID)
 {
     // Start forward call
+    DEBUG_PROFILE_START(DEBUG_PROFILE_FORWARD(OnGrenadeCreated));
     Call_StartForward(gForwardsList[OnGrenadeCreated]);
 
     // Push the parameters
@@ -353,6 +468,7 @@ void API_OnGrenadeCreated(const int clientIndex, const int grenadeIndex, const i
     
     // Finish the call
     Call_Finish();
+    DEBUG_PROFILE_STOP(DEBUG_PROFILE_FORWARD(OnGrenadeCreated));
 }
 
 /**
@@ -365,6 +481,7 @@ void API_OnGrenadeCreated(const int clientIndex, const int grenadeIndex, const i
 void API_OnWeaponCreated(const int clientIndex, const int weaponIndex, const int weaponID)
 {
     // Start forward call
+    DEBUG_PROFILE_START(DEBUG_PROFILE_FORWARD(OnWeaponCreated));
     Call_StartForward(gForwardsList[OnWeaponCreated]);
 
     // Push the parameters
@@ -374,6 +491,7 @@ void API_OnWeaponCreated(const int clientIndex, const int weaponIndex, const int
     
     // Finish the call
     Call_Finish();
+    DEBUG_PROFILE_STOP(DEBUG_PROFILE_FORWARD(OnWeaponCreated));
 }
 
 /**
@@ -394,6 +512,7 @@ Action API_OnWeaponRunCmd(const int clientIndex, int &iButtons, const int iLastB
     static Action resultHandle;
 
     // Start forward call
+    DEBUG_PROFILE_START(DEBUG_PROFILE_FORWARD(OnWeaponRunCmd));
     Call_StartForward(gForwardsList[OnWeaponRunCmd]);
 
     // Push the parameters
@@ -405,6 +524,7 @@ Action API_OnWeaponRunCmd(const int clientIndex, int &iButtons, const int iLastB
     
     // Finish the call
     Call_Finish(resultHandle);
+    DEBUG_PROFILE_STOP(DEBUG_PROFILE_FORWARD(OnWeaponRunCmd));
     
     // Return result
     return resultHandle;
@@ -420,6 +540,7 @@ Action API_OnWeaponRunCmd(const int clientIndex, int &iButtons, const int iLastB
 void API_OnWeaponDeploy(const int clientIndex, const int weaponIndex, const int weaponID)
 {
     // Start forward call
+    DEBUG_PROFILE_START(DEBUG_PROFILE_FORWARD(OnWeaponDeploy));
     Call_StartForward(gForwardsList[OnWeaponDeploy]);
 
     // Push the parameters
@@ -429,6 +550,7 @@ void API_OnWeaponDeploy(const int clientIndex, const int weaponIndex, const int
     
     // Finish the call
     Call_Finish();
+    DEBUG_PROFILE_STOP(DEBUG_PROFILE_FORWARD(OnWeaponDeploy));
 }
 
 /**
@@ -441,6 +563,7 @@ void API_OnWeaponDeploy(const int clientIndex, const int weaponIndex, const int
 void API_OnWeaponHolster(const int clientIndex, const int weaponIndex, const int weaponID)
 {
     // Start forward call
+    DEBUG_PROFILE_START(DEBUG_PROFILE_FORWARD(OnWeaponHolster));
     Call_StartForward(gForwardsList[OnWeaponHolster]);
 
     // Push the parameters
@@ -450,6 +573,7 @@ void API_OnWeaponHolster(const int clientIndex, const int weaponIndex, const int
     
     // Finish the call
     Call_Finish();
+    DEBUG_PROFILE_STOP(DEBUG_PROFILE_FORWARD(OnWeaponHolster));
 }
 
 /**
@@ -462,6 +586,7 @@ void API_OnWeaponHolster(const int clientIndex, const int weaponIndex, const int
 void API_OnWeaponReload(const int clientIndex, const int weaponIndex, const int weaponID)
 {
     // Start forward call
+    DEBUG_PROFILE_START(DEBUG_PROFILE_FORWARD(OnWeaponReload));
     Call_StartForward(gForwardsList[OnWeaponReload]);
 
     // Push the parameters
@@ -471,6 +596,7 @@ void API_OnWeaponReload(const int clientIndex, const int weaponIndex, const int
     
     // Finish the call
     Call_Finish();
+    DEBUG_PROFILE_STOP(DEBUG_PROFILE_FORWARD(OnWeaponReload));
 }
 
 /**
@@ -486,6 +612,7 @@ void API_OnWeaponReload(const int clientIndex, const int weaponIndex, const int
 void API_OnWeaponBullet(const int clientIndex, const float vBulletPosition[3], const int weaponIndex, const int weaponID)
 {
     // Start forward call
+    DEBUG_PROFILE_START(DEBUG_PROFILE_FORWARD(OnWeaponBullet));
     Call_StartForward(gForwardsList[OnWeaponBullet]);
     
     // Push the parameters
@@ -496,6 +623,7 @@ void API_OnWeaponBullet(const int clientIndex, const float vBulletPosition[3], c
     
     // Finish the call
     Call_Finish();
+    DEBUG_PROFILE_STOP(DEBUG_PROFILE_FORWARD(OnWeaponBullet));
 }
 
 /**
@@ -508,6 +636,7 @@ void API_OnWeaponBullet(const int clientIndex, const float vBulletPosition[3], c
 void API_OnWeaponShoot(const int clientIndex, const int weaponIndex, const int weaponID)
 {
     // Start forward call
+    DEBUG_PROFILE_START(DEBUG_PROFILE_FORWARD(OnWeaponShoot));
     Call_StartForward(gForwardsList[OnWeaponShoot]);
 
     // Push the parameters
@@ -517,6 +646,7 @@ void API_OnWeaponShoot(const int clientIndex, const int weaponIndex, const int w
     
     // Finish the call
     Call_Finish();
+    DEBUG_PROFILE_STOP(DEBUG_PROFILE_FORWARD(OnWeaponShoot));
 }
 
 /**
@@ -529,6 +659,7 @@ void API_OnWeaponShoot(const int clientIndex, const int weaponIndex, const int w
 void API_OnWeaponFire(const int clientIndex, const int weaponIndex, const int weaponID)
 {
     // Start forward call
+    DEBUG_PROFILE_START(DEBUG_PROFILE_FORWARD(OnWeaponFire));
     Call_StartForward(gForwardsList[OnWeaponFire]);
 
     // Push the parameters
@@ -538,6 +669,7 @@ void API_OnWeaponFire(const int clientIndex, const int weaponIndex, const int we
     
     // Finish the call
     Call_Finish();
+    DEBUG_PROFILE_STOP(DEBUG_PROFILE_FORWARD(OnWeaponFire));
 }
 
 /**
@@ -548,6 +680,7 @@ void API_OnWeaponFire(const int clientIndex, const int weaponIndex, const int we
 void API_OnZombieModStarted(const int modeIndex)
 {
     // Start forward call
+    DEBUG_PROFILE_START(DEBUG_PROFILE_FORWARD(OnZombieModStarted));
     Call_StartForward(gForwardsList[OnZombieModStarted]);
 
     // Push the parameters
@@ -555,6 +688,7 @@ void API_OnZombieModStarted(const int modeIndex)
     
     // Finish the call
     Call_Finish();
+    DEBUG_PROFILE_STOP(DEBUG_PROFILE_FORWARD(OnZombieModStarted));
 }
 
 /**
@@ -563,8 +697,35 @@ void API_OnZombieModStarted(const int modeIndex)
 void API_OnEngineExecute(/*void*/)
 {
     // Start forward call
+    DEBUG_PROFILE_START(DEBUG_PROFILE_FORWARD(OnEngineExecute));
     Call_StartForward(gForwardsList[OnEngineExecute]);
 
     // Finish the call
     Call_Finish();
-}
\ No newline at end of file
+    DEBUG_PROFILE_STOP(DEBUG_PROFILE_FORWARD(OnEngineExecute));
+}
+
+/**
+ * Called after a config file was reloaded by the difference.
+ *
+ * @param sConfig           The config alias.
+ * @param iEntries          The array of the changed entry indexes.
+ * @param iStates           The array of the entry states. (CONFIG_ENTRY_*)
+ * @param iCount            The amount of the changed entries.
+ **/
+void API_OnConfigReloaded(const char[] sConfig, const int[] iEntries, const int[] iStates, const int iCount)
+{
+    // Start forward call
+    DEBUG_PROFILE_START(DEBUG_PROFILE_FORWARD(OnConfigReloaded));
+    Call_StartForward(gForwardsList[OnConfigReloaded]);
+
+    // Push the parameters
+    Call_PushString(sConfig);
+    Call_PushArray(iEntries, iCount);
+    Call_PushArray(iStates, iCount);
+    Call_PushCell(iCount);
+    
+    // Finish the call
+    Call_Finish();
+    DEBUG_PROFILE_STOP(DEBUG_PROFILE_FORWARD(OnConfigReloaded));
+}
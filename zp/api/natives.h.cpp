@@ -31,10 +31,19 @@
 void APINativesInit(/*void*/)
 {
     CreateNative("ZP_TakeDamage",                     API_TakeDamage);
+    CreateNative("ZP_CreateKnockBack",                API_CreateKnockBack);
     CreateNative("ZP_TerminateRound",                 API_TerminateRound);
     CreateNative("ZP_UpdateTransmitState",            API_UpdateTransmitState);
     CreateNative("ZP_LookupAttachment",               API_LookupAttachment);
     CreateNative("ZP_GetAttachment",                  API_GetAttachment);
+    CreateNative("ZP_GetAttachmentByIndex",           API_GetAttachmentByIndex);
+    CreateNative("ZP_CreateClientTask",               API_CreateClientTask);
+    CreateNative("ZP_KillClientTask",                 API_KillClientTask);
+    CreateNative("ZP_KillClientTasks",                API_KillClientTasks);
+    CreateNative("ZP_RegisterCommand",                API_RegisterCommand);
+    CreateNative("ZP_UnregisterCommand",              API_UnregisterCommand);
+    CreateNative("ZP_RegisterLogModule",              API_RegisterLogModule);
+    CreateNative("ZP_LogEvent",                       API_LogEvent);
     
     CreateNative("ZP_IsPlayerInGroup",                API_IsPlayerInGroup);
     CreateNative("ZP_IsPlayerZombie",                 API_IsPlayerZombie);
@@ -43,6 +52,10 @@ void APINativesInit(/*void*/)
     CreateNative("ZP_IsPlayerSurvivor",               API_IsPlayerSurvivor);
     CreateNative("ZP_IsPlayerUseZombieSkill",         API_IsPlayerUseZombieSkill);
     CreateNative("ZP_ForceClientRespawn",             API_ForceClientRespawn);
+    CreateNative("ZP_PauseRespawnQueue",              API_PauseRespawnQueue);
+    CreateNative("ZP_FlushRespawnQueue",              API_FlushRespawnQueue);
+    CreateNative("ZP_SetClientRespawnTime",           API_SetClientRespawnTime);
+    CreateNative("ZP_GetClientRespawnTime",           API_GetClientRespawnTime);
     CreateNative("ZP_SwitchClientClass",              API_SwitchClientClass);
     CreateNative("ZP_GetClientAmmoPack",              API_GetClientAmmoPack);
     CreateNative("ZP_SetClientAmmoPack",              API_SetClientAmmoPack);
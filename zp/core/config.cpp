@@ -105,6 +105,26 @@
  **/
 #define CONFIG_MAX_LENGTH 64
 
+/**
+ * The max length of the exported keyvalue section, which is hashed by the differential reload.
+ **/
+#define CONFIG_SECTION_LENGTH 8192
+
+/**
+ * The hash of the removed entry, section hashes never have this value.
+ **/
+#define CONFIG_HASH_REMOVED 0
+
+/**
+ * @section States of the config entries after the differential reload.
+ **/
+#define CONFIG_ENTRY_ADDED              0
+#define CONFIG_ENTRY_CHANGED            1
+#define CONFIG_ENTRY_REMOVED            2
+/**
+ * @endsection
+ **/
+
 /**
  * @section Config file reference aliases.
  **/
@@ -151,6 +171,10 @@ enum ConfigData
     ConfigStructure:Data_Structure,         /** Format of the config */
     Function:Data_ReloadFunc,               /** Function to call to reload config. */
     Handle:Data_Handle,                     /** Handle of the config file. */
+    Handle:Data_Hashes,                     /** Hashes of the keyvalue sections, used by the differential reload. */
+    Data_StampSize,                         /** Size of the config file at the last parse. */
+    Data_StampTime,                         /** Modification time of the config file at the last parse. */
+    String:Data_StampPath[PLATFORM_MAX_PATH], /** Path of the config file at the last parse. */
     String:Data_Path[PLATFORM_MAX_PATH],    /** Full path to config file. */
     String:Data_Alias[CONFIG_MAX_LENGTH],   /** Config file alias, used for client interaction. */
 }
@@ -396,6 +420,92 @@ stock Handle ConfigGetConfigHandle(const ConfigFile iConfig)
     return gConfigData[iConfig][Data_Handle];
 }
 
+/**
+ * Returns the section hashes of a keyvalue config file, the array is created on the first call.
+ * 
+ * @param iConfig            Config file to get hashes of.
+ * @return                   The array of hashes, parallel to the config array.
+ **/
+stock ArrayList ConfigGetConfigHashes(const ConfigFile iConfig)
+{
+    // If array hasn't been created, then create
+    if(gConfigData[iConfig][Data_Hashes] == INVALID_HANDLE)
+    {
+        gConfigData[iConfig][Data_Hashes] = CreateArray();
+    }
+
+    // Return the array
+    return view_as<ArrayList>(gConfigData[iConfig][Data_Hashes]);
+}
+
+/**
+ * Checks that the entry was removed from the config file by the differential reload.
+ * 
+ * @param iConfig            Config file of the entry.
+ * @param iD                 The entry index.
+ * @return                   True if the entry was removed, false otherwise.
+ **/
+stock bool ConfigIsEntryRemoved(const ConfigFile iConfig, const int iD)
+{
+    // Gets the section hashes
+    ArrayList arrayHashes = ConfigGetConfigHashes(iConfig);
+    
+    // Validate the removed entry
+    return (iD < arrayHashes.Length && arrayHashes.Get(iD) == CONFIG_HASH_REMOVED);
+}
+
+/**
+ * Stores the size and the modification time of a config file after the parse.
+ * 
+ * @param iConfig            Config file to stamp.
+ **/
+stock void ConfigSetConfigStamp(const ConfigFile iConfig)
+{
+    // Gets config file path
+    static char sConfigPath[PLATFORM_MAX_PATH];
+    ConfigGetConfigPath(iConfig, sConfigPath, sizeof(sConfigPath));
+    
+    // Store the file stamp
+    gConfigData[iConfig][Data_StampSize] = FileSize(sConfigPath);
+    gConfigData[iConfig][Data_StampTime] = GetFileTime(sConfigPath, FileTime_LastChange);
+    strcopy(gConfigData[iConfig][Data_StampPath], PLATFORM_MAX_PATH, sConfigPath);
+}
+
+/**
+ * Clears the stamp of a config file, so it will be parsed on the next load.
+ * 
+ * @param iConfig            Config file to clear.
+ **/
+stock void ConfigClearConfigStamp(const ConfigFile iConfig)
+{
+    // Clear the file stamp
+    strcopy(gConfigData[iConfig][Data_StampPath], PLATFORM_MAX_PATH, "");
+}
+
+/**
+ * Checks that the parsed data of a config file is still valid.
+ * The plugin stays loaded between maps, so an unchanged file is never parsed again.
+ * 
+ * @param iConfig            Config file to check.
+ * @param arrayConfig        Handle of the main array containing file data.
+ * @return                   True if the file wasn't changed since the last parse, false otherwise.
+ **/
+stock bool ConfigIsConfigCached(const ConfigFile iConfig, const ArrayList arrayConfig)
+{
+    // If array is empty, then stop
+    if(arrayConfig == INVALID_HANDLE || !arrayConfig.Length)
+    {
+        return false;
+    }
+    
+    // Gets config file path
+    static char sConfigPath[PLATFORM_MAX_PATH];
+    ConfigGetConfigPath(iConfig, sConfigPath, sizeof(sConfigPath));
+    
+    // Validate the file stamp
+    return !strcmp(sConfigPath, gConfigData[iConfig][Data_StampPath]) && FileSize(sConfigPath) == gConfigData[iConfig][Data_StampSize] && GetFileTime(sConfigPath, FileTime_LastChange) == gConfigData[iConfig][Data_StampTime];
+}
+
 /**
  * Returns the path for a given config file entry.
  * 
@@ -424,9 +534,10 @@ stock void ConfigGetConfigAlias(const ConfigFile iConfig, char[] sAlias, const i
  * @param iConfig            The config file to load.
  * @param arrayConfig        Handle of the main array containing file data.
  * @param blockSize          The max length of the contained strings. 
+ * @param bCached            (Optional) Returns true if the file wasn't changed and the stored data was kept.
  * @return                   True if file was loaded successfuly, false otherwise.
  **/
-stock bool ConfigLoadConfig(const ConfigFile iConfig, ArrayList &arrayConfig, const int blockSize = CONFIG_MAX_LENGTH)
+stock bool ConfigLoadConfig(const ConfigFile iConfig, ArrayList &arrayConfig, const int blockSize = CONFIG_MAX_LENGTH, bool &bCached = false)
 {
     // Gets config structure
     ConfigStructure iStructure = ConfigGetConfigStructure(iConfig);
@@ -446,6 +557,13 @@ stock bool ConfigLoadConfig(const ConfigFile iConfig, ArrayList &arrayConfig, co
         arrayConfig = CreateArray(blockSize);
     }
 
+    // If the file wasn't changed since the last parse, then keep the stored data
+    bCached = ConfigIsConfigCached(iConfig, arrayConfig);
+    if(bCached)
+    {
+        return true;
+    }
+
     switch(iStructure)
     {
         case Structure_List :
@@ -488,6 +606,9 @@ stock bool ConfigLoadConfig(const ConfigFile iConfig, ArrayList &arrayConfig, co
 
             // We're done this file, so now we can destory it from memory
             delete hFile;
+            
+            // Store the file stamp
+            ConfigSetConfigStamp(iConfig);
             return true;
         }
 
@@ -537,6 +658,9 @@ stock bool ConfigLoadConfig(const ConfigFile iConfig, ArrayList &arrayConfig, co
             
             // We're done this file, so now we can destory it from memory
             delete hFile;
+            
+            // Store the file stamp
+            ConfigSetConfigStamp(iConfig);
             return true;
         }
         
@@ -555,6 +679,10 @@ stock bool ConfigLoadConfig(const ConfigFile iConfig, ArrayList &arrayConfig, co
             // Destroy all old data
             ConfigClearKvArray(arrayConfig);
             
+            // Clear the section hashes
+            ArrayList arrayHashes = ConfigGetConfigHashes(iConfig);
+            arrayHashes.Clear();
+            
             if(hKeyvalue.GotoFirstSubKey())
             {
                 do
@@ -570,12 +698,18 @@ stock bool ConfigLoadConfig(const ConfigFile iConfig, ArrayList &arrayConfig, co
                     
                     // Store this handle in the main array
                     arrayConfig.Push(arrayConfigEntry);
+                    
+                    // Store the hash of the section for the next reload
+                    arrayHashes.Push(ConfigKvGetSectionHash(hKeyvalue));
                 } 
                 while(hKeyvalue.GotoNextKey());
             }
             
             // We're done this file for now, so now we can destory it from memory 
             delete hKeyvalue;
+            
+            // Store the file stamp
+            ConfigSetConfigStamp(iConfig);
             return true;
         }
     }
@@ -609,6 +743,167 @@ stock bool ConfigReloadConfig(const ConfigFile iConfig)
     return true;
 }
 
+/**
+ * Reload a keyvalue config file by the difference with the loaded entries.
+ * Entries are matched by the section name. Unchanged entries are skipped, changed entries are recached in place
+ * and new entries are appended, so the indexes of the existing entries stay valid for the sub-plugins.
+ * Removed entries keep their index until the map change, but are marked, so the menu builders skip them.
+ * 
+ * @param iConfig            The config file entry to reload.
+ * @param arrayConfig        The array of the config entries.
+ * @param iCacheFunc         The function to cache one entry: public void(KeyValues kv, int iD), the keyvalue is on the section.
+ * @return                   The amount of the added, changed and removed entries, or -1 if the file failed to open.
+ **/
+stock int ConfigReloadKeyvalue(const ConfigFile iConfig, const ArrayList arrayConfig, const Function iCacheFunc)
+{
+    // Open file
+    KeyValues hKeyvalue;
+    bool bSuccess = ConfigOpenConfigFile(iConfig, hKeyvalue);
+    
+    // If config file failed to open, then stop
+    if(!bSuccess)
+    {
+        return -1;
+    }
+    
+    // Gets the section hashes
+    ArrayList arrayHashes = ConfigGetConfigHashes(iConfig);
+    
+    // Initialize the map of names
+    StringMap trieIndexes = CreateTrie();
+    static char sKeyName[CONFIG_MAX_LENGTH];
+    
+    // i = array index
+    int iSize = arrayConfig.Length;
+    for(int i = 0; i < iSize; i++)
+    {
+        // Gets the entry name
+        ArrayList arrayConfigEntry = arrayConfig.Get(i);
+        arrayConfigEntry.GetString(0, sKeyName, sizeof(sKeyName));
+        
+        // Map the name to the index
+        trieIndexes.SetValue(sKeyName, i);
+    }
+    
+    // Initialize the list of changes
+    ArrayList arrayChanges = CreateArray(2);
+    bool[] bFound = new bool[iSize + 1];
+    
+    if(hKeyvalue.GotoFirstSubKey())
+    {
+        do
+        {
+            // Gets the section name and the hash
+            hKeyvalue.GetSectionName(sKeyName, sizeof(sKeyName));
+            int iHash = ConfigKvGetSectionHash(hKeyvalue);
+            
+            // Find the loaded entry
+            int iD; int iState;
+            if(trieIndexes.GetValue(sKeyName, iD))
+            {
+                // If the section is a duplicate, then skip
+                if(iD >= iSize || bFound[iD])
+                {
+                    continue;
+                }
+                bFound[iD] = true;
+                
+                // If the section wasn't changed, then skip
+                if(arrayHashes.Get(iD) == iHash)
+                {
+                    continue;
+                }
+                
+                // Clear the cached data, but keep the name
+                ArrayList arrayConfigEntry = arrayConfig.Get(iD);
+                arrayConfigEntry.Resize(1);
+                arrayHashes.Set(iD, iHash);
+                iState = CONFIG_ENTRY_CHANGED;
+            }
+            else
+            {
+                // Create new array to store information for config entry
+                ArrayList arrayConfigEntry = CreateArray(CONFIG_MAX_LENGTH);
+                arrayConfigEntry.PushString(sKeyName); // Index: 0
+                
+                // Append the entry, old indexes are not moved
+                iD = arrayConfig.Push(arrayConfigEntry);
+                arrayHashes.Push(iHash);
+                trieIndexes.SetValue(sKeyName, iD);
+                iState = CONFIG_ENTRY_ADDED;
+            }
+            
+            // Cache the entry
+            Call_StartFunction(GetMyHandle(), iCacheFunc);
+            Call_PushCell(hKeyvalue);
+            Call_PushCell(iD);
+            Call_Finish();
+            
+            // Store the change
+            int iChange[2]; iChange[0] = iD; iChange[1] = iState;
+            arrayChanges.PushArray(iChange);
+        } 
+        while(hKeyvalue.GotoNextKey());
+    }
+    
+    // i = array index
+    bool bRemoved;
+    for(int i = 0; i < iSize; i++)
+    {
+        // Validate the removed entry
+        if(!bFound[i])
+        {
+            // Validate the entry, which is already removed
+            bRemoved = true;
+            if(arrayHashes.Get(i) == CONFIG_HASH_REMOVED)
+            {
+                continue;
+            }
+            
+            // Mark the entry, its data stays valid for the sub-plugins
+            arrayHashes.Set(i, CONFIG_HASH_REMOVED);
+            
+            // Store the change
+            int iChange[2]; iChange[0] = i; iChange[1] = CONFIG_ENTRY_REMOVED;
+            arrayChanges.PushArray(iChange);
+        }
+    }
+    
+    // We're done this file, so now we can destory it from memory
+    delete hKeyvalue;
+    delete trieIndexes;
+    
+    // Store the file stamp, the removed entries are dropped by the full parse on the next map
+    if(bRemoved) ConfigClearConfigStamp(iConfig); else ConfigSetConfigStamp(iConfig);
+    
+    // Gets the amount of changes
+    int iCount = arrayChanges.Length;
+    if(iCount)
+    {
+        // Gets config alias
+        static char sConfigAlias[CONFIG_MAX_LENGTH];
+        ConfigGetConfigAlias(iConfig, sConfigAlias, sizeof(sConfigAlias));
+        
+        // Split the changes
+        int[] iEntries = new int[iCount]; int[] iStates = new int[iCount];
+        for(int i = 0; i < iCount; i++)
+        {
+            iEntries[i] = arrayChanges.Get(i, 0);
+            iStates[i] = arrayChanges.Get(i, 1);
+        }
+        
+        // Call forward
+        API_OnConfigReloaded(sConfigAlias, iEntries, iStates, iCount);
+        
+        // Log action
+        LogEvent(true, LogType_Normal, LOG_CORE_EVENTS, LogModule_Config, "Config Reload", "Reloaded config file \"%s\": %d entries changed", sConfigAlias, iCount);
+    }
+    
+    // Return amount of changes
+    delete arrayChanges;
+    return iCount;
+}
+
 /**
  * Opens a config file with appropriate method.
  * 
@@ -997,4 +1292,43 @@ stock bool ConfigKvGetStringBool(const KeyValues kv, const char[] sKey, const ch
     
     // Convert string to bool
     return ConfigSettingToBool(sValue);
-}
\ No newline at end of file
+}
+
+/**
+ * Returns a hash of the current keyvalue section with all its keys.
+ * 
+ * @param kv                The keyvalue handle.
+ * @return                  The FNV-1a hash of the exported section, never CONFIG_HASH_REMOVED.
+ **/
+stock int ConfigKvGetSectionHash(const KeyValues kv)
+{
+    // Copy the section into the separate tree
+    KeyValues kvSection = CreateKeyValues("section");
+    kvSection.Import(kv);
+    
+    // Export the section to the text
+    static char sBuffer[CONFIG_SECTION_LENGTH];
+    kvSection.ExportToString(sBuffer, sizeof(sBuffer));
+    
+    // Validate the truncated export
+    if(kvSection.ExportLength > sizeof(sBuffer))
+    {
+        // Log the section, changes after the limit aren't detected by the reload
+        static char sName[CONFIG_MAX_LENGTH];
+        kv.GetSectionName(sName, sizeof(sName));
+        LogEvent(false, LogType_Error, LOG_CORE_EVENTS, LogModule_Config, "Config Validation", "Section \"%s\" is longer than %d bytes, changes after the limit aren't detected by the reload", sName, CONFIG_SECTION_LENGTH);
+    }
+    delete kvSection;
+    
+    // i = char index
+    int iHash = 0x811C9DC5;
+    for(int i = 0; sBuffer[i]; i++)
+    {
+        // Mix the char
+        iHash ^= sBuffer[i];
+        iHash *= 0x01000193;
+    }
+    
+    // Return the hash
+    return (iHash != CONFIG_HASH_REMOVED) ? iHash : 1;
+}
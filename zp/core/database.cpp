@@ -40,6 +40,33 @@ Handle hDataBase = INVALID_HANDLE;
  **/
 char SteamID[MAXPLAYERS+1][STEAMID_MAX_LENGTH];
 
+/**
+ * Top list data block.
+ **/
+enum DataBaseTopData
+{
+    String:DataBaseTop_Name[NORMAL_LINE_LENGTH],
+    DataBaseTop_Level,
+    DataBaseTop_Exp,
+    DataBaseTop_Kills,
+    DataBaseTop_Infections
+}
+
+/**
+ * Array to store the cached top list.
+ **/
+ArrayList arrayDataBaseTop;
+
+/**
+ * Cached amount of the stored players.
+ **/
+int gDataBaseTotal;
+
+/**
+ * Timer for refreshing the cached stats.
+ **/
+Handle hDataBaseTimer = INVALID_HANDLE;
+
 /**
  * Create a SQL database connection.
  **/
@@ -71,7 +98,7 @@ void DataBaseLoad(/*void*/)
     // Initialize variables
     static char sError[BIG_LINE_LENGTH];
     static char sDriver[SMALL_LINE_LENGTH]; 
-    static char sRequest[PLATFORM_MAX_PATH+PLATFORM_MAX_PATH];
+    static char sRequest[PLATFORM_MAX_PATH*4]; /// Schema request with the indexes
 
     // Creates an SQL connection from a named configuration
     hDataBase = SQL_Connect(sDataBase , false, sError, sizeof(sError));
@@ -135,8 +162,15 @@ void DataBaseLoad(/*void*/)
                                            `rebuy` int(64) NOT NULL, \
                                            `costume` int(64) NOT NULL, \
                                            `time` int(64) NOT NULL, \
+                                           `name` varchar(64) NOT NULL DEFAULT '', \
+                                           `kills` int(64) NOT NULL DEFAULT 0, \
+                                           `infections` int(64) NOT NULL DEFAULT 0, \
                                             PRIMARY KEY (`id`), \
-                                            UNIQUE KEY `steam_id` (`steam_id`))", 
+                                            UNIQUE KEY `steam_id` (`steam_id`), \
+                                            KEY `level_exp` (`level`, `exp`), \
+                                            KEY `kills` (`kills`), \
+                                            KEY `infections` (`infections`), \
+                                            KEY `time` (`time`))", 
         sDataBase);
         /*______________________________________________________________________*/
     }
@@ -153,7 +187,10 @@ void DataBaseLoad(/*void*/)
                                             hclass INTEGER, \
                                             rebuy INTEGER, \
                                             costume INTEGER, \
-                                            time INTEGER)",
+                                            time INTEGER, \
+                                            name TEXT DEFAULT '', \
+                                            kills INTEGER DEFAULT 0, \
+                                            infections INTEGER DEFAULT 0)",
         sDataBase);
         /*_______________________________________________________________________*/
     }
@@ -172,9 +209,152 @@ void DataBaseLoad(/*void*/)
         // Log database validation info
         LogEvent(true, LogType_Normal, LOG_CORE_EVENTS, LogModule_Database, "Database Validation", "Executed database: \"%s\" | Connection type: \"%s\" | Request : \"%s\"", sDataBase, MySQL ? "MySQL" : "SQlite", sRequest);
     }
+    
+    // Upgrade the table of the old versions
+    DataBaseUpgrade(sDataBase, MySQL);
 
     // Unlock base
     SQL_UnlockDatabase(hDataBase);
+    
+    // Initialize the top list
+    if(arrayDataBaseTop == INVALID_HANDLE)
+    {
+        arrayDataBaseTop = CreateArray(view_as<int>(DataBaseTopData));
+    }
+    
+    // Refresh the cached stats now, and then on the interval
+    DataBaseOnRefresh(INVALID_HANDLE);
+    delete hDataBaseTimer;
+    hDataBaseTimer = CreateTimer(gCvarList[CVAR_GAME_CUSTOM_DATABASE_RATE].FloatValue, DataBaseOnRefresh, _, TIMER_REPEAT | TIMER_FLAG_NO_MAPCHANGE);
+}
+
+/**
+ * Purge the refresh timer on the map end.
+ **/
+void DataBasePurge(/*void*/)
+{
+    // Purge the timer
+    hDataBaseTimer = INVALID_HANDLE; /// with flag TIMER_FLAG_NO_MAPCHANGE
+}
+
+/**
+ * Cvars are created.
+ **/
+void DataBaseOnCvarInit(/*void*/)
+{
+    // Hook cvars
+    HookConVarChange(gCvarList[CVAR_GAME_CUSTOM_DATABASE_RATE], DataBaseOnCvarHook);
+}
+
+/**
+ * Cvar hook callback. (zp_game_custom_database_rate)
+ * Recreates the refresh timer with the new interval.
+ * 
+ * @param hConVar           The cvar handle.
+ * @param oldValue          The value before the attempted change.
+ * @param newValue          The new value.
+ **/
+public void DataBaseOnCvarHook(ConVar hConVar, const char[] oldValue, const char[] newValue)
+{
+    // If the timer isn't running, then stop
+    if(hDataBaseTimer == INVALID_HANDLE)
+    {
+        return;
+    }
+    
+    // Recreate the timer
+    delete hDataBaseTimer;
+    hDataBaseTimer = CreateTimer(hConVar.FloatValue, DataBaseOnRefresh, _, TIMER_REPEAT | TIMER_FLAG_NO_MAPCHANGE);
+}
+
+/**
+ * Adds the stats columns and indexes to the table. Should be called under the database lock.
+ *
+ * @param sDataBase         The table name.
+ * @param MySQL             True for the MySQL driver, false for the SQlite.
+ **/
+void DataBaseUpgrade(const char[] sDataBase, const bool MySQL)
+{
+    // Initialize variables
+    static char sError[BIG_LINE_LENGTH];
+    static char sRequest[PLATFORM_MAX_PATH+PLATFORM_MAX_PATH];
+    
+    // Validate the stats columns
+    Format(sRequest, sizeof(sRequest), "SELECT kills FROM `%s` LIMIT 1", sDataBase);
+    if(!SQL_FastQuery(hDataBase, sRequest))
+    {
+        /// Format requests
+        if(MySQL)
+        {
+            /*______________________________________________________________________*/
+            Format(sRequest, sizeof(sRequest), "ALTER TABLE `%s` \
+                                               ADD COLUMN `name` varchar(64) NOT NULL DEFAULT '', \
+                                               ADD COLUMN `kills` int(64) NOT NULL DEFAULT 0, \
+                                               ADD COLUMN `infections` int(64) NOT NULL DEFAULT 0, \
+                                               ADD KEY `level_exp` (`level`, `exp`), \
+                                               ADD KEY `kills` (`kills`), \
+                                               ADD KEY `infections` (`infections`), \
+                                               ADD KEY `time` (`time`)", 
+            sDataBase);
+            /*______________________________________________________________________*/
+            
+            // Sent a request
+            if(!SQL_FastQuery(hDataBase, sRequest))
+            {
+                // Gets an error, if it exist
+                SQL_GetError(hDataBase, sError, sizeof(sError));
+
+                // Unexpected error, log it
+                LogEvent(false, LogType_Error, LOG_CORE_EVENTS, LogModule_Database, "Database Validation", "\"%s\" in request: \"%s\"", sError, sRequest);
+            }
+        }
+        else
+        {
+            // SQlite adds only one column per request
+            static char sColumn[3][SMALL_LINE_LENGTH] = { "name TEXT DEFAULT ''", "kills INTEGER DEFAULT 0", "infections INTEGER DEFAULT 0" };
+            
+            // i = column index
+            for(int i = 0; i < sizeof(sColumn); i++)
+            {
+                // Sent a request
+                Format(sRequest, sizeof(sRequest), "ALTER TABLE `%s` ADD COLUMN %s", sDataBase, sColumn[i]);
+                if(!SQL_FastQuery(hDataBase, sRequest))
+                {
+                    // Gets an error, if it exist
+                    SQL_GetError(hDataBase, sError, sizeof(sError));
+
+                    // Unexpected error, log it
+                    LogEvent(false, LogType_Error, LOG_CORE_EVENTS, LogModule_Database, "Database Validation", "\"%s\" in request: \"%s\"", sError, sRequest);
+                }
+            }
+        }
+        
+        // Log database validation info
+        LogEvent(true, LogType_Normal, LOG_CORE_EVENTS, LogModule_Database, "Database Validation", "Upgraded database: \"%s\" with the stats columns", sDataBase);
+    }
+    
+    // SQlite creates indexes outside of the table, index names are shared by all tables
+    if(!MySQL)
+    {
+        // Initialize the indexes
+        static char sIndex[4][SMALL_LINE_LENGTH] = { "level_exp", "kills", "infections", "time" };
+        static char sIndexColumn[4][SMALL_LINE_LENGTH] = { "level, exp", "kills", "infections", "time" };
+        
+        // i = index number
+        for(int i = 0; i < sizeof(sIndex); i++)
+        {
+            // Sent a request
+            Format(sRequest, sizeof(sRequest), "CREATE INDEX IF NOT EXISTS `%s_%s` ON `%s` (%s)", sDataBase, sIndex[i], sDataBase, sIndexColumn[i]);
+            if(!SQL_FastQuery(hDataBase, sRequest))
+            {
+                // Gets an error, if it exist
+                SQL_GetError(hDataBase, sError, sizeof(sError));
+
+                // Unexpected error, log it
+                LogEvent(false, LogType_Error, LOG_CORE_EVENTS, LogModule_Database, "Database Validation", "\"%s\" in request: \"%s\"", sError, sRequest);
+            }
+        }
+    }
 }
 
 /**
@@ -187,6 +367,177 @@ void DataBaseOnCommandsCreate(/*void*/)
     AddCommandListener(DataBaseOnExit, "quit");
     AddCommandListener(DataBaseOnExit, "restart");
     AddCommandListener(DataBaseOnExit, "_restart");
+    RegConsoleCmd("ztop", DataBaseTopCommandCatched, "Open the top players menu.");
+    RegConsoleCmd("zrank", DataBaseRankCommandCatched, "Prints the rank of the player.");
+}
+
+/**
+ * Handles the <!ztop> command. Open the top players menu.
+ * 
+ * @param clientIndex       The client index.
+ * @param iArguments        The number of arguments that were in the argument string.
+ **/ 
+public Action DataBaseTopCommandCatched(const int clientIndex, const int iArguments)
+{
+    // Open the top menu
+    DataBaseMenuTop(clientIndex);
+    return Plugin_Handled;
+}
+
+/**
+ * Handles the <!zrank> command. Prints the rank of the player.
+ * 
+ * @param clientIndex       The client index.
+ * @param iArguments        The number of arguments that were in the argument string.
+ **/ 
+public Action DataBaseRankCommandCatched(const int clientIndex, const int iArguments)
+{
+    // Validate client
+    if(!IsPlayerExist(clientIndex, false))
+    {
+        return Plugin_Handled;
+    }
+    
+    // If rank wasn't cached yet, then stop
+    if(gClientData[clientIndex][Client_Rank] < 1)
+    {
+        TranslationPrintToChat(clientIndex, "rank empty");
+        return Plugin_Handled;
+    }
+    
+    // Print the cached rank
+    TranslationPrintToChat(clientIndex, "rank info", gClientData[clientIndex][Client_Rank], gDataBaseTotal, gClientData[clientIndex][Client_Level], gClientData[clientIndex][Client_Exp], gClientData[clientIndex][Client_Kills], gClientData[clientIndex][Client_Infections]);
+    return Plugin_Handled;
+}
+
+/**
+ * Creates the top players menu from the cached list.
+ *
+ * @param clientIndex       The client index.
+ **/
+void DataBaseMenuTop(const int clientIndex)
+{
+    // Validate client
+    if(!IsPlayerExist(clientIndex, false) || arrayDataBaseTop == INVALID_HANDLE)
+    {
+        return;
+    }
+    
+    // Initialize variables
+    static char sBuffer[BIG_LINE_LENGTH]; int iTop[DataBaseTopData];
+    
+    // Create menu handle
+    Menu hMenu = CreateMenu(DataBaseMenuTopSlots);
+    
+    // Sets the language to target
+    SetGlobalTransTarget(clientIndex);
+    
+    // Sets title
+    hMenu.SetTitle("%t", "top players");
+    
+    // i = top position
+    int iSize = arrayDataBaseTop.Length;
+    for(int i = 0; i < iSize; i++)
+    {
+        // Gets the player data
+        arrayDataBaseTop.GetArray(i, iTop, sizeof(iTop));
+        
+        // Show option
+        Format(sBuffer, sizeof(sBuffer), "%t", "top info", i + 1, iTop[DataBaseTop_Name], iTop[DataBaseTop_Level], iTop[DataBaseTop_Exp], iTop[DataBaseTop_Kills], iTop[DataBaseTop_Infections]);
+        hMenu.AddItem("", sBuffer, ITEMDRAW_DISABLED);
+    }
+    
+    // If there are no players, add an "(Empty)" line
+    if(!iSize)
+    {
+        Format(sBuffer, sizeof(sBuffer), "%t", "empty");
+        hMenu.AddItem("empty", sBuffer, ITEMDRAW_DISABLED);
+    }
+    
+    // Sets options and display it
+    hMenu.ExitButton = true;
+    hMenu.Display(clientIndex, MENU_TIME_FOREVER); 
+}
+
+/**
+ * Called when client selects option in the top players menu, and handles it.
+ *  
+ * @param hMenu             The handle of the menu being used.
+ * @param mAction           The action done on the menu (see menus.inc, enum MenuAction).
+ * @param clientIndex       The client index.
+ * @param mSlot             The slot index selected (starting from 0).
+ **/ 
+public int DataBaseMenuTopSlots(Menu hMenu, MenuAction mAction, const int clientIndex, const int mSlot)
+{
+    // Client hit 'Exit' button
+    if(mAction == MenuAction_End)
+    {
+        delete hMenu;
+    }
+}
+
+/**
+ * Timer for refreshing the cached top list and ranks.
+ *
+ * @param hTimer            The timer handle.
+ **/
+public Action DataBaseOnRefresh(Handle hTimer)
+{
+    // If database doesn't exist, then stop
+    if(hDataBase == INVALID_HANDLE)
+    {
+        // Clear timer
+        if(hTimer == hDataBaseTimer) hDataBaseTimer = INVALID_HANDLE;
+        return Plugin_Stop;
+    }
+    
+    // Initialize variables
+    static char sRequest[PLATFORM_MAX_PATH+PLATFORM_MAX_PATH]; 
+
+    // Gets database name
+    static char sDataBase[SMALL_LINE_LENGTH];
+    gCvarList[CVAR_CONFIG_NAME_DATABASE].GetString(sDataBase, sizeof(sDataBase));
+    
+    // Sent a request for the top list, which is read by the level/exp index
+    Format(sRequest, sizeof(sRequest), "SELECT name, level, exp, kills, infections FROM `%s` ORDER BY level DESC, exp DESC LIMIT %d", sDataBase, gCvarList[CVAR_GAME_CUSTOM_DATABASE_TOP].IntValue);
+    SQL_TQuery(hDataBase, SQLBaseTop_Callback, sRequest);
+    
+    // Sent a request for the amount of players
+    Format(sRequest, sizeof(sRequest), "SELECT COUNT(*) FROM `%s`", sDataBase);
+    SQL_TQuery(hDataBase, SQLBaseTotal_Callback, sRequest);
+    
+    // i = client index
+    for(int i = 1; i <= MaxClients; i++)
+    {
+        // Validate loaded client
+        if(IsPlayerExist(i, false) && gClientData[i][Client_Loaded])
+        {
+            // Sent a request for the rank
+            DataBaseRefreshRank(i);
+        }
+    }
+    
+    // Allow timer
+    return Plugin_Continue;
+}
+
+/**
+ * Sent a threaded request for the rank of the client.
+ *
+ * @param clientIndex       The client index.
+ **/
+void DataBaseRefreshRank(const int clientIndex)
+{
+    // Initialize variables
+    static char sRequest[PLATFORM_MAX_PATH+PLATFORM_MAX_PATH]; 
+
+    // Gets database name
+    static char sDataBase[SMALL_LINE_LENGTH];
+    gCvarList[CVAR_CONFIG_NAME_DATABASE].GetString(sDataBase, sizeof(sDataBase));
+    
+    // Count the players ahead, which is read by the level/exp index
+    Format(sRequest, sizeof(sRequest), "SELECT COUNT(*) FROM `%s` WHERE level > %d OR (level = %d AND exp > %d)", sDataBase, gClientData[clientIndex][Client_Level], gClientData[clientIndex][Client_Level], gClientData[clientIndex][Client_Exp]);
+    SQL_TQuery(hDataBase, SQLBaseRank_Callback, sRequest, GetClientUserId(clientIndex));
 }
 
 /**
@@ -270,7 +621,9 @@ void DataBaseClientInit(const int clientIndex)
                                                        hclass, \
                                                        rebuy, \
                                                        costume, \
-                                                       time \
+                                                       time, \
+                                                       kills, \
+                                                       infections \
                                                 FROM `%s` WHERE steam_id = '%s'", 
             sDataBase, SteamID[clientIndex]);
             /*_________________________________________________*/
@@ -314,6 +667,9 @@ void DataBaseOnClientDisconnect(const int clientIndex)
  **/
 public void SQLBaseExtract_Callback(Handle hDriver, Handle hResult, const char[] sSQLerror, const int clientIndex)
 {
+    // Profile the callback
+    DEBUG_PROFILE_START(Profile_Database);
+    
     // Make sure the client didn't disconnect while the thread was running
     if(IsPlayerExist(clientIndex, false))
     {
@@ -338,6 +694,8 @@ public void SQLBaseExtract_Callback(Handle hDriver, Handle hResult, const char[]
                 gClientData[clientIndex][Client_AutoRebuy] = view_as<bool>(SQL_FetchInt(hResult, 6));
                 gClientData[clientIndex][Client_Costume] = SQL_FetchInt(hResult, 7);
                 gClientData[clientIndex][Client_Time] = SQL_FetchInt(hResult, 8);
+                gClientData[clientIndex][Client_Kills] = SQL_FetchInt(hResult, 9);
+                gClientData[clientIndex][Client_Infections] = SQL_FetchInt(hResult, 10);
 
                 // Update info in the database
                 DataBaseSaveClientInfo(clientIndex);
@@ -384,8 +742,107 @@ public void SQLBaseExtract_Callback(Handle hDriver, Handle hResult, const char[]
             
             // Client was loaded
             gClientData[clientIndex][Client_Loaded] = true;
+            
+            // Sent a request for the rank
+            DataBaseRefreshRank(clientIndex);
         }
     }
+    
+    // Stop profiling
+    DEBUG_PROFILE_STOP(Profile_Database);
+}
+
+/**
+ * Callback for the threaded request of the top list.
+ *
+ * @param hDriver            Parent object of the handle.
+ * @param hResult            Handle to the child object.
+ * @param sSQLerror          Error string if there was an error.
+ * @param iData              Data passed in via the original threaded invocation.
+ **/
+public void SQLBaseTop_Callback(Handle hDriver, Handle hResult, const char[] sSQLerror, const int iData)
+{
+    // Profile the callback
+    DEBUG_PROFILE_START(Profile_Database);
+    
+    // If invalid query handle
+    if(hResult == INVALID_HANDLE)
+    {
+        // Unexpected error, log it
+        LogEvent(false, LogType_Error, LOG_CORE_EVENTS, LogModule_Database, "Database Query", "%s", sSQLerror);
+    }
+    else
+    {
+        // Clear the cached list
+        arrayDataBaseTop.Clear();
+        
+        // Initialize variable
+        int iTop[DataBaseTopData];
+        
+        // Gets the players data
+        while(SQL_FetchRow(hResult))
+        {
+            SQL_FetchString(hResult, 0, iTop[DataBaseTop_Name], NORMAL_LINE_LENGTH);
+            iTop[DataBaseTop_Level] = SQL_FetchInt(hResult, 1);
+            iTop[DataBaseTop_Exp] = SQL_FetchInt(hResult, 2);
+            iTop[DataBaseTop_Kills] = SQL_FetchInt(hResult, 3);
+            iTop[DataBaseTop_Infections] = SQL_FetchInt(hResult, 4);
+            arrayDataBaseTop.PushArray(iTop, sizeof(iTop));
+        }
+    }
+    
+    // Stop profiling
+    DEBUG_PROFILE_STOP(Profile_Database);
+}
+
+/**
+ * Callback for the threaded request of the amount of players.
+ *
+ * @param hDriver            Parent object of the handle.
+ * @param hResult            Handle to the child object.
+ * @param sSQLerror          Error string if there was an error.
+ * @param iData              Data passed in via the original threaded invocation.
+ **/
+public void SQLBaseTotal_Callback(Handle hDriver, Handle hResult, const char[] sSQLerror, const int iData)
+{
+    // If invalid query handle
+    if(hResult == INVALID_HANDLE)
+    {
+        // Unexpected error, log it
+        LogEvent(false, LogType_Error, LOG_CORE_EVENTS, LogModule_Database, "Database Query", "%s", sSQLerror);
+    }
+    else if(SQL_FetchRow(hResult))
+    {
+        // Gets the amount
+        gDataBaseTotal = SQL_FetchInt(hResult, 0);
+    }
+}
+
+/**
+ * Callback for the threaded request of the client rank.
+ *
+ * @param hDriver            Parent object of the handle.
+ * @param hResult            Handle to the child object.
+ * @param sSQLerror          Error string if there was an error.
+ * @param userID             Data passed in via the original threaded invocation.
+ **/
+public void SQLBaseRank_Callback(Handle hDriver, Handle hResult, const char[] sSQLerror, const int userID)
+{
+    // If invalid query handle
+    if(hResult == INVALID_HANDLE)
+    {
+        // Unexpected error, log it
+        LogEvent(false, LogType_Error, LOG_CORE_EVENTS, LogModule_Database, "Database Query", "%s", sSQLerror);
+        return;
+    }
+    
+    // Make sure the client didn't disconnect while the thread was running
+    int clientIndex = GetClientOfUserId(userID);
+    if(clientIndex && SQL_FetchRow(hResult))
+    {
+        // Gets the rank
+        gClientData[clientIndex][Client_Rank] = SQL_FetchInt(hResult, 0) + 1;
+    }
 }
 
 /**
@@ -405,6 +862,11 @@ void DataBaseSaveClientInfo(const int clientIndex)
     // Gets the system time as a unix timestamp
     int bigUnix = GetTime();
     
+    // Gets the escaped client name
+    static char sName[NORMAL_LINE_LENGTH]; static char sNameEscaped[NORMAL_LINE_LENGTH*2+1];
+    GetClientName(clientIndex, sName, sizeof(sName));
+    SQL_EscapeString(hDataBase, sName, sNameEscaped, sizeof(sNameEscaped));
+    
     /// Format request
     if(gClientData[clientIndex][Client_DataID] < 1)
     {
@@ -416,10 +878,13 @@ void DataBaseSaveClientInfo(const int clientIndex)
                                                             hclass = %d, \
                                                             rebuy = %d, \
                                                             costume = %d, \
-                                                            time = %d \
+                                                            time = %d, \
+                                                            name = '%s', \
+                                                            kills = %d, \
+                                                            infections = %d \
                                                         WHERE steam_id = '%s'", 
                                                             
-        sDataBase, gClientData[clientIndex][Client_AmmoPacks], gClientData[clientIndex][Client_Level], gClientData[clientIndex][Client_Exp], gClientData[clientIndex][Client_ZombieClassNext], gClientData[clientIndex][Client_HumanClassNext], gClientData[clientIndex][Client_AutoRebuy], gClientData[clientIndex][Client_Costume], bigUnix, SteamID[clientIndex]);
+        sDataBase, gClientData[clientIndex][Client_AmmoPacks], gClientData[clientIndex][Client_Level], gClientData[clientIndex][Client_Exp], gClientData[clientIndex][Client_ZombieClassNext], gClientData[clientIndex][Client_HumanClassNext], gClientData[clientIndex][Client_AutoRebuy], gClientData[clientIndex][Client_Costume], bigUnix, sNameEscaped, gClientData[clientIndex][Client_Kills], gClientData[clientIndex][Client_Infections], SteamID[clientIndex]);
         /*_______________________________________________________________*/
     }
     else
@@ -432,9 +897,12 @@ void DataBaseSaveClientInfo(const int clientIndex)
                                                             hclass = %d, \
                                                             rebuy = %d, \
                                                             costume = %d, \
-                                                            time = %d \
+                                                            time = %d, \
+                                                            name = '%s', \
+                                                            kills = %d, \
+                                                            infections = %d \
                                                         WHERE id = %d",   
-        sDataBase, gClientData[clientIndex][Client_AmmoPacks], gClientData[clientIndex][Client_Level], gClientData[clientIndex][Client_Exp], gClientData[clientIndex][Client_ZombieClassNext], gClientData[clientIndex][Client_HumanClassNext], gClientData[clientIndex][Client_AutoRebuy], gClientData[clientIndex][Client_Costume], bigUnix, gClientData[clientIndex][Client_DataID]);
+        sDataBase, gClientData[clientIndex][Client_AmmoPacks], gClientData[clientIndex][Client_Level], gClientData[clientIndex][Client_Exp], gClientData[clientIndex][Client_ZombieClassNext], gClientData[clientIndex][Client_HumanClassNext], gClientData[clientIndex][Client_AutoRebuy], gClientData[clientIndex][Client_Costume], bigUnix, sNameEscaped, gClientData[clientIndex][Client_Kills], gClientData[clientIndex][Client_Infections], gClientData[clientIndex][Client_DataID]);
         /*_______________________________________________________________*/
     }
 
@@ -25,6 +25,69 @@
  * ============================================================================
  **/
 
+/**
+ * @section Profiler values.
+ **/
+#define DEBUG_PROFILE_MAX     64    /** Maximum amount of the profiled hooks, including forwards. */
+#define DEBUG_PROFILE_BUCKETS 24    /** Amount of the time buckets, bucket i holds [2^i, 2^(i+1)) microseconds. */
+/**
+ * @endsection
+ **/
+
+/**
+ * List of the profiled hooks, forwards are placed after the last one.
+ **/
+enum DebugProfile
+{
+    Profile_RunCmd,
+    Profile_TraceAttack,
+    Profile_TakeDamage,
+    Profile_PostThinkPost,
+    Profile_TransmitAttachment,
+    Profile_TransmitCostume,
+    Profile_NormalSound,
+    Profile_Database,
+    Profile_Forward
+}
+
+/**
+ * Starts and stops profiling of the hook, if profiling is enabled. (single expression, safe under the unbraced if/else)
+ **/
+#define DEBUG_PROFILE_START(%0) (CVAR_MIRROR(Mirror_DebugProfile) && DebugProfileStart(view_as<int>(%0)))
+#define DEBUG_PROFILE_STOP(%0)  (CVAR_MIRROR(Mirror_DebugProfile) && DebugProfileStop(view_as<int>(%0)))
+
+/**
+ * Gets the profile index of the global forward.
+ **/
+#define DEBUG_PROFILE_FORWARD(%0) (view_as<int>(Profile_Forward) + view_as<int>(%0))
+
+/**
+ * Arrays to store the profiler data.
+ **/
+Profiler hDebugProfiler[DEBUG_PROFILE_MAX];
+char gDebugProfileName[DEBUG_PROFILE_MAX][SMALL_LINE_LENGTH];
+int gDebugProfileDepth[DEBUG_PROFILE_MAX];
+int gDebugProfileCount[DEBUG_PROFILE_MAX];
+float gDebugProfileTotal[DEBUG_PROFILE_MAX];
+float gDebugProfileMax[DEBUG_PROFILE_MAX];
+int gDebugProfileBucket[DEBUG_PROFILE_MAX][DEBUG_PROFILE_BUCKETS];
+
+/**
+ * Initialize the profiler names.
+ **/
+void DebugInit(/*void*/)
+{
+    // Register names of the hooks
+    DebugProfileRegister(view_as<int>(Profile_RunCmd),             "OnPlayerRunCmd");
+    DebugProfileRegister(view_as<int>(Profile_TraceAttack),        "SDKHook_TraceAttack");
+    DebugProfileRegister(view_as<int>(Profile_TakeDamage),         "SDKHook_OnTakeDamage");
+    DebugProfileRegister(view_as<int>(Profile_PostThinkPost),      "SDKHook_PostThinkPost");
+    DebugProfileRegister(view_as<int>(Profile_TransmitAttachment), "SDKHook_SetTransmit (attachment)");
+    DebugProfileRegister(view_as<int>(Profile_TransmitCostume),    "SDKHook_SetTransmit (costume)");
+    DebugProfileRegister(view_as<int>(Profile_NormalSound),        "NormalSoundHook");
+    DebugProfileRegister(view_as<int>(Profile_Database),           "Database callback");
+}
+
 /**
  * Creates commands for debug module. Called when commands are created.
  **/
@@ -32,6 +95,274 @@ void DebugOnCommandsCreate(/*void*/)
 {
     // Hook commands
     RegAdminCmd("zp_debug", DebugCommandCatched, ADMFLAG_GENERIC, "Prints debugging dump info the log file.");
+    RegAdminCmd("zp_perf", DebugPerfCommandCatched, ADMFLAG_GENERIC, "Prints or resets the hook profiling table. Usage: zp_perf [reset]");
+}
+
+/**
+ * Hook debug cvar changes.
+ **/
+void DebugOnCvarInit(/*void*/)
+{
+    // Hook cvars
+    HookConVarChange(gCvarList[CVAR_DEBUG_PROFILE], DebugOnCvarHook);
+}
+
+/**
+ * Cvar hook callback (zp_debug_profile)
+ * Resets the profiling counters.
+ * 
+ * @param hConVar           The cvar handle.
+ * @param oldValue          The value before the attempted change.
+ * @param newValue          The new value.
+ **/
+public void DebugOnCvarHook(ConVar hConVar, const char[] oldValue, const char[] newValue)
+{
+    // Reset the counters, calls in the progress are dropped
+    DebugProfileReset();
+}
+
+/**
+ * Sets the report name of the profiled hook.
+ *
+ * @param iD                The profile index.
+ * @param sName             The name.
+ **/
+void DebugProfileRegister(const int iD, const char[] sName)
+{
+    strcopy(gDebugProfileName[iD], sizeof(gDebugProfileName[]), sName);
+}
+
+/**
+ * Resets all profiling counters.
+ **/
+void DebugProfileReset(/*void*/)
+{
+    // i = profile index
+    for(int i = 0; i < DEBUG_PROFILE_MAX; i++)
+    {
+        // Resets the counters
+        gDebugProfileDepth[i] = 0;
+        gDebugProfileCount[i] = 0;
+        gDebugProfileTotal[i] = 0.0;
+        gDebugProfileMax[i] = 0.0;
+        
+        // x = bucket index
+        for(int x = 0; x < DEBUG_PROFILE_BUCKETS; x++)
+        {
+            gDebugProfileBucket[i][x] = 0;
+        }
+    }
+}
+
+/**
+ * Starts profiling of the hook. Nested calls of the same hook are counted by the outer one.
+ *
+ * @param iD                The profile index.
+ * @return                  Always true, for the use in the macro expression.
+ **/
+bool DebugProfileStart(const int iD)
+{
+    // Validate nested call
+    if(gDebugProfileDepth[iD]++)
+    {
+        return true;
+    }
+
+    // Validate profiler
+    if(hDebugProfiler[iD] == null)
+    {
+        hDebugProfiler[iD] = new Profiler();
+    }
+    
+    // Start profiling
+    hDebugProfiler[iD].Start();
+    return true;
+}
+
+/**
+ * Stops profiling of the hook and updates the counters.
+ *
+ * @param iD                The profile index.
+ * @return                  Always true, for the use in the macro expression.
+ **/
+bool DebugProfileStop(const int iD)
+{
+    // Validate nested call
+    if(gDebugProfileDepth[iD] <= 0 || --gDebugProfileDepth[iD])
+    {
+        return true;
+    }
+
+    // Stop profiling
+    hDebugProfiler[iD].Stop();
+    float flTime = hDebugProfiler[iD].Time;
+    
+    // Update the counters
+    gDebugProfileCount[iD]++;
+    gDebugProfileTotal[iD] += flTime;
+    if(flTime > gDebugProfileMax[iD]) gDebugProfileMax[iD] = flTime;
+    
+    // Gets the bucket of the time in microseconds
+    int iMicro = RoundToFloor(flTime * 1000000.0); int iBucket;
+    while(iMicro > 1 && iBucket < DEBUG_PROFILE_BUCKETS - 1)
+    {
+        iMicro >>= 1;
+        iBucket++;
+    }
+    
+    // Update the bucket
+    gDebugProfileBucket[iD][iBucket]++;
+    return true;
+}
+
+/**
+ * Gets the upper bound of the bucket with the 99th percentile.
+ *
+ * @param iD                The profile index.
+ * @return                  The time in microseconds.
+ **/
+int DebugProfileGetP99(const int iD)
+{
+    // Gets the amount of calls above the percentile
+    int iRemain = gDebugProfileCount[iD] - RoundToCeil(float(gDebugProfileCount[iD]) * 0.99);
+
+    // i = bucket index, from the slowest one
+    for(int i = DEBUG_PROFILE_BUCKETS - 1; i > 0; i--)
+    {
+        // Validate bucket
+        iRemain -= gDebugProfileBucket[iD][i];
+        if(iRemain < 0)
+        {
+            return 1 << (i + 1);
+        }
+    }
+    
+    // Fastest bucket
+    return 2;
+}
+
+/**
+ * Handles the <!zp_perf> command. Prints or resets the profiling table.
+ * 
+ * @param clientIndex       The client index.
+ * @param iArguments        The number of arguments that were in the argument string.
+ **/ 
+public Action DebugPerfCommandCatched(const int clientIndex, const int iArguments)
+{
+    // Validate reset
+    if(iArguments)
+    {
+        // Gets argument string
+        static char sArgument[SMALL_LINE_LENGTH];
+        GetCmdArg(1, sArgument, sizeof(sArgument));
+        
+        // Reset the counters
+        if(!strcmp(sArgument, "reset", false))
+        {
+            DebugProfileReset();
+            ReplyToCommand(clientIndex, "Profiling counters were reset.");
+            return Plugin_Handled;
+        }
+    }
+
+    // Validate profiling
+    if(!CVAR_MIRROR(Mirror_DebugProfile))
+    {
+        ReplyToCommand(clientIndex, "Profiling is disabled. Set zp_debug_profile 1 to enable it.");
+    }
+    
+    // Print header
+    ReplyToCommand(clientIndex, "%-36s %9s %10s %9s %9s %9s", "Hook", "Calls", "Total(ms)", "Avg(us)", "Max(us)", "P99(us)");
+    ReplyToCommand(clientIndex, "--------------------------------------------------------------------------------------");
+    
+    // i = profile index
+    for(int i = 0; i < DEBUG_PROFILE_MAX; i++)
+    {
+        // Validate calls
+        if(!gDebugProfileCount[i])
+        {
+            continue;
+        }
+        
+        // Print row
+        ReplyToCommand(clientIndex, "%-36s %9d %10.2f %9.1f %9.1f %9d", gDebugProfileName[i], gDebugProfileCount[i], gDebugProfileTotal[i] * 1000.0, gDebugProfileTotal[i] * 1000000.0 / float(gDebugProfileCount[i]), gDebugProfileMax[i] * 1000000.0, DebugProfileGetP99(i));
+    }
+    return Plugin_Handled;
+}
+
+/*
+ * Profiled hooks.
+ */
+
+/**
+ * Hook: TraceAttack
+ **/
+public Action DebugOnTraceAttack(const int victimIndex, int &attackerIndex, int &inflicterIndex, float &damageAmount, int &damageType, int &ammoType, int hitgroupBox, int hitgroupIndex)
+{
+    // Profile the hook
+    DEBUG_PROFILE_START(Profile_TraceAttack);
+    Action resultHandle = DamageOnTraceAttack(victimIndex, attackerIndex, inflicterIndex, damageAmount, damageType, ammoType, hitgroupBox, hitgroupIndex);
+    DEBUG_PROFILE_STOP(Profile_TraceAttack);
+    return resultHandle;
+}
+
+/**
+ * Hook: OnTakeDamage
+ **/
+public Action DebugOnTakeDamage(const int victimIndex, int &attackerIndex, int &inflictorIndex, float &damageAmount, int &damageType, int &weaponIndex, const float damageForce[3], const float damagePosition[3])
+{
+    // Profile the hook
+    DEBUG_PROFILE_START(Profile_TakeDamage);
+    Action resultHandle = DamageOnTakeDamage(victimIndex, attackerIndex, inflictorIndex, damageAmount, damageType, weaponIndex, damageForce, damagePosition);
+    DEBUG_PROFILE_STOP(Profile_TakeDamage);
+    return resultHandle;
+}
+
+/**
+ * Hook: PostThinkPost
+ **/
+public void DebugOnPostThinkPost(const int clientIndex)
+{
+    // Profile the hook
+    DEBUG_PROFILE_START(Profile_PostThinkPost);
+    WeaponSDKOnAnimationFix(clientIndex);
+    DEBUG_PROFILE_STOP(Profile_PostThinkPost);
+}
+
+/**
+ * Hook: SetTransmit (attachment)
+ **/
+public Action DebugOnAttachmentTransmit(const int entityIndex, const int clientIndex)
+{
+    // Profile the hook
+    DEBUG_PROFILE_START(Profile_TransmitAttachment);
+    Action resultHandle = WeaponAttachmentOnTransmit(entityIndex, clientIndex);
+    DEBUG_PROFILE_STOP(Profile_TransmitAttachment);
+    return resultHandle;
+}
+
+/**
+ * Hook: SetTransmit (costume)
+ **/
+public Action DebugOnCostumeTransmit(const int entityIndex, const int clientIndex)
+{
+    // Profile the hook
+    DEBUG_PROFILE_START(Profile_TransmitCostume);
+    Action resultHandle = CostumesOnTransmit(entityIndex, clientIndex);
+    DEBUG_PROFILE_STOP(Profile_TransmitCostume);
+    return resultHandle;
+}
+
+/**
+ * Hook: NormalSound
+ **/
+public Action DebugOnNormalSound(int clients[MAXPLAYERS-1], int &numClients, char[] sSample, int &entityIndex, int &iChannel, float &flVolume, int &iLevel, int &iPitch, int &iFrags)
+{
+    // Profile the hook
+    DEBUG_PROFILE_START(Profile_NormalSound);
+    Action resultHandle = PlayerSoundsNormalHook(clients, numClients, sSample, entityIndex, iChannel, flVolume, iLevel, iPitch, iFrags);
+    DEBUG_PROFILE_STOP(Profile_NormalSound);
+    return resultHandle;
 }
 
 /**
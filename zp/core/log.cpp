@@ -42,6 +42,24 @@
  * @endsection
  **/
  
+/**
+ * @section Log buffer flush interval.
+ **/
+#define LOG_BUFFER_INTERVAL 1.0
+/**
+ * @endsection
+ **/
+ 
+/**
+ * @section Types of the buffered log lines, stored in the first char.
+ **/
+#define LOG_BUFFER_NORMAL  'N'    /** Written by LogMessage. */
+#define LOG_BUFFER_ERROR   'E'    /** Written by LogError. */
+#define LOG_BUFFER_COMMAND 'C'    /** Written to the zombieplague.log. */
+/**
+ * @endsection
+ **/
+ 
 /**
  * @section Log flags.
  **/
@@ -72,8 +90,7 @@ enum LogTypes
  * 
  * Update following when adding modules:
  * - Admin log flag menu
- * - LogGetModuleNameString
- * - LogGetModule
+ * - LogInit (register in the same order)
  **/
 enum LogModules
 {
@@ -102,14 +119,36 @@ enum LogModules
 }
 
 /**
- * Dynamic string array for module filtering.
+ * Maximum amount of the registered modules, including modules of the sub-plugins.
+ **/
+#define LOG_MODULE_MAX 64
+
+/**
+ * Map to store the module ids by the short names.
  **/
-ArrayList arrayLogModuleFilter;
+StringMap trieLogModules;
+
+/**
+ * Arrays to store the short and the human readable module names by the ids.
+ **/
+ArrayList arrayLogModuleNames;
+ArrayList arrayLogModuleTitles;
 
 /**
  * Cache of current module filter settings. For fast and easy access.
  **/
-int LogModuleFilterCache[LogModules];
+bool LogModuleFilterCache[LOG_MODULE_MAX];
+
+/**
+ * Array to store the buffered log lines.
+ **/
+ArrayList arrayLogBuffer;
+
+/**
+ * Amount of the buffered log lines and the dropped lines on the buffer overflow.
+ **/
+int gLogBufferCount;
+int gLogBufferDropped;
 
 
 /**
@@ -127,108 +166,228 @@ void LogOnCommandsCreate(/*void*/)
  **/
 void LogInit(/*void*/)
 {
-    // Destroy existing handle to prevent memory leak
-    if(arrayLogModuleFilter != INVALID_HANDLE)
-    {
-        delete arrayLogModuleFilter;
-    }
+    // Initialize module registry
+    trieLogModules = CreateTrie();
+    arrayLogModuleNames = CreateArray(SMALL_LINE_LENGTH);
+    arrayLogModuleTitles = CreateArray(SMALL_LINE_LENGTH);
     
-    // Initialize module filter array
-    arrayLogModuleFilter = CreateArray(32);
+    // Register modules in the order of the list
+    LogRegisterModule("",              "");
+    LogRegisterModule("engine",        "Engine");
+    LogRegisterModule("config",        "Config");
+    LogRegisterModule("debug",         "Debug");
+    LogRegisterModule("tools",         "Tools");
+    LogRegisterModule("database",      "Database");
+    LogRegisterModule("models",        "Models");
+    LogRegisterModule("sounds",        "Sounds");
+    LogRegisterModule("downloads",     "Downloads");
+    LogRegisterModule("weapons",       "Weapons");
+    LogRegisterModule("effects",       "Effects");
+    LogRegisterModule("menus",         "Menus");
+    LogRegisterModule("hitgroups",     "Hitgroups");
+    LogRegisterModule("antistick",     "Antistick");
+    LogRegisterModule("zombieclasses", "Zombie Classes");
+    LogRegisterModule("humanclasses",  "Human Classes");
+    LogRegisterModule("extraitems",    "Extra Items");
+    LogRegisterModule("costumes",      "Costumes");
+    LogRegisterModule("gamemodes",     "Game Modes");
+    LogRegisterModule("admin",         "Admin");
+    LogRegisterModule("native",        "Native");
+    
+    // Initialize buffer array
+    arrayLogBuffer = CreateArray(ByteCountToCells(LOG_MAX_LENGTH_FILE));
+    
+    // Create timer for the buffer flush
+    CreateTimer(LOG_BUFFER_INTERVAL, LogOnFlushTimer, _, TIMER_REPEAT);
 }
 
 /**
- * Converts a string module name into a module type.
+ * Timer callback, writes the buffered log lines.
  *
- * @param sModuleName       A string with the short module name. Case insensitive,
- *                          but not trimmed for white space.
- * @return                  The matcing module type or LogModules_Invalid if failed.
+ * @param hTimer            The timer handle.
  **/
-LogModules LogGetModule(char[] sModuleName)
+public Action LogOnFlushTimer(Handle hTimer)
 {
-    if(!strcmp(sModuleName, "engine", false))
-    {
-        return LogModule_Engine;
-    }
-    else if(!strcmp(sModuleName, "config", false))
-    {
-        return LogModule_Config;
-    }
-    else if(!strcmp(sModuleName, "debug", false))
-    {
-        return LogModule_Debug;
-    }
-    else if(!strcmp(sModuleName, "tools", false))
-    {
-        return LogModule_Tools;
-    }
-    else if(!strcmp(sModuleName, "database", false))
-    {
-        return LogModule_Database;
-    }
-    else if(!strcmp(sModuleName, "models", false))
-    {
-        return LogModule_Models;
-    }
-    else if(!strcmp(sModuleName, "sounds", false))
-    {
-        return LogModule_Sounds;
-    }
-    else if(!strcmp(sModuleName, "downloads", false))
-    {
-        return LogModule_Downloads;
-    }
-    else if(!strcmp(sModuleName, "weapons", false))
-    {
-        return LogModule_Weapons;
-    }
-    else if(!strcmp(sModuleName, "effects", false))
+    // Write the buffer
+    LogFlush();
+    
+    // Allow timer
+    return Plugin_Continue;
+}
+
+/**
+ * Push a log line into the buffer.
+ *
+ * @param logType           Log type of the line. (normal, error or command)
+ * @param sLine             The log line.
+ **/
+void LogBufferPush(const LogTypes logType, const char[] sLine)
+{
+    // Validate buffer size
+    int iCapacity = gCvarList[CVAR_LOG_BUFFER].IntValue;
+    if(arrayLogBuffer.Length != iCapacity)
     {
-        return LogModule_Effects;
+        // Write the buffer, and resize it
+        LogFlush();
+        arrayLogBuffer.Resize(iCapacity);
     }
-    else if(!strcmp(sModuleName, "menus", false))
+    
+    // Validate overflow
+    if(gLogBufferCount >= iCapacity)
     {
-        return LogModule_Menus;
+        // Drop the line, the amount is written on the next flush
+        gLogBufferDropped++;
+        return;
     }
-    else if(!strcmp(sModuleName, "hitgroups", false))
+
+    // Initialize variable
+    static char sBuffer[LOG_MAX_LENGTH_FILE];
+    
+    // Validate command line
+    if(logType == LogType_Command)
     {
-        return LogModule_Hitgroups;
+        // Gets the current time, the line is written to the log file
+        static char sTime[SMALL_LINE_LENGTH];
+        FormatTime(sTime, sizeof(sTime), "%m/%d/%Y - %H:%M:%S");
+        FormatEx(sBuffer, sizeof(sBuffer), "%cL %s: %s", LOG_BUFFER_COMMAND, sTime, sLine);
     }
-    else if(!strcmp(sModuleName, "antistick", false))
+    else
     {
-        return LogModule_Antistick;
+        // Store the type, the line is written by sourcemod
+        FormatEx(sBuffer, sizeof(sBuffer), "%c%s", (logType == LogType_Error) ? LOG_BUFFER_ERROR : LOG_BUFFER_NORMAL, sLine);
     }
-    else if(!strcmp(sModuleName, "zombieclasses", false))
+    
+    // Push the line
+    arrayLogBuffer.SetString(gLogBufferCount++, sBuffer);
+}
+
+/**
+ * Writes the buffered log lines in one batch.
+ **/
+void LogFlush(/*void*/)
+{
+    // Validate buffer
+    if(!gLogBufferCount && !gLogBufferDropped)
     {
-        return LogModule_Zombieclasses;
+        return;
     }
-    else if(!strcmp(sModuleName, "humanclasses", false))
+    
+    // Initialize variables
+    static char sBuffer[LOG_MAX_LENGTH_FILE]; File hFile;
+    
+    // i = line index
+    for(int i = 0; i < gLogBufferCount; i++)
     {
-        return LogModule_Humanclasses;
+        // Gets the line
+        arrayLogBuffer.GetString(i, sBuffer, sizeof(sBuffer));
+        
+        // Switch the line type
+        switch(sBuffer[0])
+        {
+            case LOG_BUFFER_NORMAL : LogMessage("%s", sBuffer[1]);
+            case LOG_BUFFER_ERROR  : LogError("%s", sBuffer[1]);
+            case LOG_BUFFER_COMMAND :
+            {
+                // Open the log file once
+                if(hFile == null) hFile = OpenFile(LOG_FILE, "a");
+                
+                // Write the line
+                if(hFile != null) hFile.WriteLine("%s", sBuffer[1]);
+            }
+        }
     }
-    else if(!strcmp(sModuleName, "extraitems", false))
+    
+    // Validate overflow
+    if(gLogBufferDropped)
     {
-        return LogModule_Extraitems;
+        // Write the amount of dropped lines
+        LogError("[Log] [Buffer] Dropped %d messages on the buffer overflow, increase \"zp_log_buffer\"", gLogBufferDropped);
     }
-    else if(!strcmp(sModuleName, "costumes", false))
+
+    // Close the file
+    delete hFile;
+    
+    // Clear the buffer
+    gLogBufferCount = 0;
+    gLogBufferDropped = 0;
+}
+
+/**
+ * Registers a module, or returns the id of the registered one.
+ *
+ * @param sModuleName       The short module name. Case insensitive.
+ * @param sModuleTitle      The human readable module name.
+ * @return                  The module id or LogModule_Invalid if the registry is full.
+ **/
+LogModules LogRegisterModule(const char[] sModuleName, const char[] sModuleTitle)
+{
+    // Gets the lower case name
+    static char sName[SMALL_LINE_LENGTH];
+    LogGetModuleKey(sModuleName, sName, sizeof(sName));
+    
+    // Validate registered module
+    int iModule;
+    if(trieLogModules.GetValue(sName, iModule))
     {
-        return LogModule_Costumes;
+        return view_as<LogModules>(iModule);
     }
-    else if(!strcmp(sModuleName, "gamemodes", false))
+
+    // Validate registry size
+    iModule = arrayLogModuleNames.Length;
+    if(iModule >= LOG_MODULE_MAX)
     {
-        return LogModule_Gamemodes;
+        return LogModule_Invalid;
     }
-    else if(!strcmp(sModuleName, "admin", false))
+    
+    // Push the names
+    arrayLogModuleNames.PushString(sName);
+    arrayLogModuleTitles.PushString(sModuleTitle);
+    trieLogModules.SetValue(sName, iModule);
+    return view_as<LogModules>(iModule);
+}
+
+/**
+ * Converts a module name into the registry key.
+ *
+ * @param sModuleName       The module name.
+ * @param sKey              The string to return key in.
+ * @param iMaxLen           The max length of the string.
+ **/
+void LogGetModuleKey(const char[] sModuleName, char[] sKey, const int iMaxLen)
+{
+    // i = char index
+    int i;
+    for(; sModuleName[i] != '\0' && i < iMaxLen - 1; i++)
     {
-        return LogModule_Admin;
+        sKey[i] = CharToLower(sModuleName[i]);
     }
-    else if(!strcmp(sModuleName, "native", false))
+    
+    // Terminate string
+    sKey[i] = '\0';
+}
+
+/**
+ * Converts a string module name into a module type.
+ *
+ * @param sModuleName       A string with the short module name. Case insensitive,
+ *                          but not trimmed for white space.
+ * @return                  The matcing module type or LogModules_Invalid if failed.
+ **/
+LogModules LogGetModule(const char[] sModuleName)
+{
+    // Gets the lower case name
+    static char sName[SMALL_LINE_LENGTH];
+    LogGetModuleKey(sModuleName, sName, sizeof(sName));
+    
+    // Validate module, skip the invalid one
+    int iModule;
+    if(!sName[0] || !trieLogModules.GetValue(sName, iModule))
     {
-        return LogModule_Native;
+        return LogModule_Invalid;
     }
 
-    // No match
-    return LogModule_Invalid;
+    // Return the id
+    return view_as<LogModules>(iModule);
 }
 
 /**
@@ -239,8 +398,8 @@ LogModules LogGetModule(char[] sModuleName)
  **/
 bool LogCheckFlag(int eventType)
 {
-    // Check if eventType is set
-    return eventType ? true : false;
+    // Check if eventType is set in the mask
+    return (CVAR_MIRROR(Mirror_LogFlags) & eventType) ? true : false;
 }
 
 /**
@@ -252,7 +411,7 @@ bool LogCheckFlag(int eventType)
 bool LogCheckModuleFilter(const LogModules iModule)
 {
     // Check if filter is set
-    return LogModuleFilterCache[iModule] ? true : false;
+    return LogModuleFilterCache[view_as<int>(iModule)];
 }
 
 /**
@@ -267,92 +426,17 @@ bool LogCheckModuleFilter(const LogModules iModule)
  **/
 int LogGetModuleNameString(char[] sBuffer, const int iMaxLen, const LogModules iModule, const bool shortName = false)
 {
-    switch(iModule)
+    // Validate module
+    int iD = view_as<int>(iModule);
+    if(iD <= 0 || iD >= arrayLogModuleNames.Length)
     {
-        case LogModule_Engine :
-        {
-            return shortName ? strcopy(sBuffer, iMaxLen, "engine") : strcopy(sBuffer, iMaxLen, "Engine");
-        }
-        case LogModule_Config :
-        {
-            return shortName ? strcopy(sBuffer, iMaxLen, "config") : strcopy(sBuffer, iMaxLen, "Config");
-        }
-        case LogModule_Debug :
-        {
-            return shortName ? strcopy(sBuffer, iMaxLen, "debug") : strcopy(sBuffer, iMaxLen, "Debug");
-        }
-        case LogModule_Tools :
-        {
-            return shortName ? strcopy(sBuffer, iMaxLen, "tools") : strcopy(sBuffer, iMaxLen, "Tools");
-        }
-        case LogModule_Database :
-        {
-            return shortName ? strcopy(sBuffer, iMaxLen, "database") : strcopy(sBuffer, iMaxLen, "Database");
-        }
-        case LogModule_Models :
-        {
-            return shortName ? strcopy(sBuffer, iMaxLen, "models") : strcopy(sBuffer, iMaxLen, "Models");
-        }
-        case LogModule_Sounds :
-        {
-            return shortName ? strcopy(sBuffer, iMaxLen, "sounds") : strcopy(sBuffer, iMaxLen, "Sounds");
-        }
-        case LogModule_Downloads :
-        {
-            return shortName ? strcopy(sBuffer, iMaxLen, "downloads") : strcopy(sBuffer, iMaxLen, "Downloads");
-        }
-        case LogModule_Weapons :
-        {
-            return shortName ? strcopy(sBuffer, iMaxLen, "weapons") : strcopy(sBuffer, iMaxLen, "Weapons");
-        }
-        case LogModule_Effects :
-        {
-            return shortName ? strcopy(sBuffer, iMaxLen, "effects") : strcopy(sBuffer, iMaxLen, "Effects");
-        }
-        case LogModule_Menus :
-        {
-            return shortName ? strcopy(sBuffer, iMaxLen, "menus") : strcopy(sBuffer, iMaxLen, "Menus");
-        }
-        case LogModule_Hitgroups:
-        {
-            return shortName ? strcopy(sBuffer, iMaxLen, "hitgroups") : strcopy(sBuffer, iMaxLen, "Hitgroups");
-        }
-        case LogModule_Antistick:
-        {
-            return shortName ? strcopy(sBuffer, iMaxLen, "antistick") : strcopy(sBuffer, iMaxLen, "Antistick");
-        }
-        case LogModule_Zombieclasses :
-        {
-            return shortName ? strcopy(sBuffer, iMaxLen, "zombieclasses") : strcopy(sBuffer, iMaxLen, "Zombie Classes");
-        }
-        case LogModule_Humanclasses :
-        {
-            return shortName ? strcopy(sBuffer, iMaxLen, "humanclasses") : strcopy(sBuffer, iMaxLen, "Human Classes");
-        }
-        case LogModule_Extraitems :
-        {
-            return shortName ? strcopy(sBuffer, iMaxLen, "extraitems") : strcopy(sBuffer, iMaxLen, "Extra Items");
-        }
-        case LogModule_Costumes :
-        {
-            return shortName ? strcopy(sBuffer, iMaxLen, "costumes") : strcopy(sBuffer, iMaxLen, "Costumes");
-        }
-        case LogModule_Gamemodes :
-        {
-            return shortName ? strcopy(sBuffer, iMaxLen, "gamemodes") : strcopy(sBuffer, iMaxLen, "Game Modes");
-        }
-        case LogModule_Admin :
-        {
-            return shortName ? strcopy(sBuffer, iMaxLen, "admin") : strcopy(sBuffer, iMaxLen, "Admin");
-        }
-        case LogModule_Native :
-        {
-            return shortName ? strcopy(sBuffer, iMaxLen, "native") : strcopy(sBuffer, iMaxLen, "Native");
-        }
+        // Module mismatch
+        sBuffer[0] = '\0';
+        return 0;
     }
 
-    // Module mismatch
-    return 0;
+    // Gets the name
+    return shortName ? arrayLogModuleNames.GetString(iD, sBuffer, iMaxLen) : arrayLogModuleTitles.GetString(iD, sBuffer, iMaxLen);
 }
 
 /**
@@ -373,25 +457,50 @@ int LogGetModuleNameString(char[] sBuffer, const int iMaxLen, const LogModules i
  **/
 void LogEvent(const bool isConsole = false, const LogTypes logType = LogType_Normal, const int eventType = LOG_CORE_EVENTS, const LogModules iModule, const char[] sDescription, const char[] sMessage, any ...)
 {    
+    // Check filters before formatting
+    if(!LogCheckEvent(isConsole, logType, eventType, iModule))
+    {
+        return;
+    }
+
+    // Format extra parameters into the log buffer
+    static char sLogBuffer[LOG_MAX_LENGTH_FILE];
+    VFormat(sLogBuffer, sizeof(sLogBuffer), sMessage, 7);
+
+    // Write the message
+    LogEventWrite(logType, iModule, sDescription, sLogBuffer);
+}
+
+/**
+ * Check whether the log event passes the log settings.
+ *
+ * @param isConsole         Specifies whether the log event came from client 0.
+ * @param logType           Log type and action.
+ * @param eventType         A log flag describing What kind of log event it is.
+ * @param iModule           Module the log event were executed in.
+ * @return                  True if the event should be logged, false otherwise.
+ **/
+bool LogCheckEvent(const bool isConsole, const LogTypes logType, const int eventType, const LogModules iModule)
+{
     // Check filter overrides. Always log fatal errors, and check error override setting on error log types
     if((logType != LogType_Fatal && logType != LogType_Error) || (logType == LogType_Error && !gCvarList[CVAR_LOG_ERROR_OVERRIDE].BoolValue))
     {
         // Check iflogging is disabled
-        if(!gCvarList[CVAR_LOG].BoolValue)
+        if(!CVAR_MIRROR(Mirror_Log))
         {
-            return;
+            return false;
         }
 
         // Check if console is ignored
         if(isConsole && gCvarList[CVAR_LOG_IGNORE_CONSOLE].BoolValue)
         {
-            return;
+            return false;
         }
 
         // Check event type (log flag)
         if(!LogCheckFlag(eventType))
         {
-            return;
+            return false;
         }
 
         // Check ifmodule filtering is enabled
@@ -400,21 +509,32 @@ void LogEvent(const bool isConsole = false, const LogTypes logType = LogType_Nor
             // Check if the specified module is enabled
             if(!LogCheckModuleFilter(iModule))
             {
-                return;
+                return false;
             }
         }
     }
 
-    // Format extra parameters into the log buffer
-    static char sLogBuffer[LOG_MAX_LENGTH_FILE];
-    VFormat(sLogBuffer, sizeof(sLogBuffer), sMessage, 7);
+    // Allow event
+    return true;
+}
 
+/**
+ * Write a formatted log message depending on the log type.
+ *
+ * @param logType           Log type and action.
+ * @param iModule           Module the log event were executed in.
+ * @param sDescription      Event type or function name.
+ * @param sMessage          The formatted log message.
+ **/
+void LogEventWrite(const LogTypes logType, const LogModules iModule, const char[] sDescription, const char[] sMessage)
+{
     // Gets human readable module name
     static char sModule[SMALL_LINE_LENGTH];
     LogGetModuleNameString(sModule, sizeof(sModule), iModule);
 
     // Format 
-    Format(sLogBuffer, sizeof(sLogBuffer), "[%s] [%s] %s", sModule, sDescription, sLogBuffer);
+    static char sLogBuffer[LOG_MAX_LENGTH_FILE];
+    FormatEx(sLogBuffer, sizeof(sLogBuffer), "[%s] [%s] %s", sModule, sDescription, sMessage);
 
     // Format other parameters onto the log text
     switch(logType)
@@ -422,16 +542,18 @@ void LogEvent(const bool isConsole = false, const LogTypes logType = LogType_Nor
         // Log type is normal
         case LogType_Normal:
         {
-            LogMessage(sLogBuffer);
+            if(gCvarList[CVAR_LOG_BUFFER].IntValue) LogBufferPush(logType, sLogBuffer); else LogMessage(sLogBuffer);
         }
         // Log type is error
         case LogType_Error:
         {
-            LogError(sLogBuffer);
+            if(gCvarList[CVAR_LOG_BUFFER].IntValue) LogBufferPush(logType, sLogBuffer); else LogError(sLogBuffer);
         }
         // Log type is fatal error
         case LogType_Fatal:
         {
+            // Write the buffered lines before the plugin is stopped
+            LogFlush();
             SetFailState(sLogBuffer);
         }
         // Log type is native error
@@ -442,7 +564,7 @@ void LogEvent(const bool isConsole = false, const LogTypes logType = LogType_Nor
         // Log type is command
         case LogType_Command:
         {
-            LogToFile(LOG_FILE, sLogBuffer);
+            if(gCvarList[CVAR_LOG_BUFFER].IntValue) LogBufferPush(logType, sLogBuffer); else LogToFile(LOG_FILE, sLogBuffer);
         }
     }
 
@@ -456,103 +578,41 @@ void LogEvent(const bool isConsole = false, const LogTypes logType = LogType_Nor
 
 
 /**
- * Adds a module to the module filter and updates the cache. If it already
- * exist the command is ignored.
+ * Adds a module to the module filter. If it already exist the command is ignored.
  *
  * @param iModule           The module to add.
  * @return                  True if added, false otherwise.
  **/
 bool LogModuleFilterAdd(const LogModules iModule)
 {
-    // Initialize some chars
-    static char sModuleName[SMALL_LINE_LENGTH];
-    
-    // Check ifempty
-    if(!strlen(sModuleName))
-    {
-        return false;
-    }
-    
-    // Convert module name
-    LogGetModuleNameString(sModuleName, sizeof(sModuleName), iModule, true);
-    
     // Check if the module isn't already is listed
-    if(arrayLogModuleFilter.FindString(sModuleName) == -1)
+    if(LogModuleFilterCache[view_as<int>(iModule)])
     {
-        // Add module to filter
-        arrayLogModuleFilter.PushString(sModuleName);
-        return true;
+        return false;
     }
     
-    return false;
+    // Add module to filter
+    LogModuleFilterCache[view_as<int>(iModule)] = true;
+    return true;
 }
 
 /**
- * Removes a module to the module filter and updates the cache. If it doesn't
- * exist the command is ignored.
+ * Removes a module to the module filter. If it doesn't exist the command is ignored.
  *
  * @param iModule            The module to remove.
  * @return                   True ifremoved, false otherwise.
  **/
 bool LogModuleFilterRemove(const LogModules iModule)
 {
-    // Initialize some chars
-    static char sModuleName[SMALL_LINE_LENGTH]; int iModuleIndex;
-    
-    // Check ifempty
-    if(!strlen(sModuleName))
+    // Check if the module is listed
+    if(!LogModuleFilterCache[view_as<int>(iModule)])
     {
         return false;
     }
     
-    // Convert module name
-    LogGetModuleNameString(sModuleName, sizeof(sModuleName), iModule, true);
-    
-    // Gets the module index
-    iModuleIndex = arrayLogModuleFilter.FindString(sModuleName);
-    
-    // Check if successful
-    if(iModuleIndex)
-    {
-        // Remove module from filter
-        arrayLogModuleFilter.Erase(iModuleIndex);
-        return true;
-    }
-    
-    return false;
-}
-
-/**
- * Update module filter cache.
- **/
-void LogModuleFilterCacheUpdate(/*void*/)
-{
-    static char sModuleName[SMALL_LINE_LENGTH]; LogModules iModuleType;
-    
-    // Clear all entries in module cache
-    int iModuleCount = sizeof(LogModuleFilterCache);
-    for(int i = 1; i < iModuleCount; i++)
-    {
-        LogModuleFilterCache[view_as<LogModules>(i)] = false;
-    }
-    
-    // Loop through the module array
-    int iSize = arrayLogModuleFilter.Length;
-    for(int i = 0; i < iSize; i++)
-    {
-        // Gets the module name
-        arrayLogModuleFilter.GetString(i, sModuleName, sizeof(sModuleName));
-        
-        // Convert to type
-        iModuleType = LogGetModule(sModuleName);
-        
-        // Validate type
-        if(iModuleType != LogModule_Invalid)
-        {
-            // Sets value in cache
-            LogModuleFilterCache[iModuleType] = true;
-        }
-    }
+    // Remove module from filter
+    LogModuleFilterCache[view_as<int>(iModule)] = false;
+    return true;
 }
 
 /**
@@ -622,12 +682,12 @@ public Action Command_LogList(const int clientIndex, const int iArguments)
     sBuffer[0] = 0;
     
     // Module status:
-    int iModulecount = sizeof(LogModuleFilterCache);
+    int iModulecount = arrayLogModuleNames.Length;
     for(int i = 1; i < iModulecount; i++)
     {
         LogGetModuleNameString(sModuleName, sizeof(sModuleName), view_as<LogModules>(i));
         LogGetModuleNameString(sPhraseShortName, sizeof(sPhraseShortName), view_as<LogModules>(i), true);
-        Format(sLineBuffer, sizeof(sLineBuffer), "%-23s %-19s %s", sModuleName, sPhraseShortName, LogModuleFilterCache[view_as<LogModules>(i)] ? "On" : "Off");
+        Format(sLineBuffer, sizeof(sLineBuffer), "%-23s %-19s %s", sModuleName, sPhraseShortName, LogModuleFilterCache[i] ? "On" : "Off");
         ReplyToCommand(clientIndex, sLineBuffer);
     }
     return Plugin_Handled;
@@ -680,8 +740,6 @@ public Action Command_LogAddModule(const int clientIndex, const int iArguments)
         ReplyToCommand(clientIndex, "Added \"%s\" to module filter.", sArgument);
     }
 
-    // Update cache
-    LogModuleFilterCacheUpdate();
     return Plugin_Handled;
 }
 
@@ -732,7 +790,74 @@ public Action Command_LogRemoveModule(const int clientIndex, const int iArgument
         ReplyToCommand(clientIndex, "Removed \"%s\" from module filter.", sArgument);
     }
     
-    // Update cache.
-    LogModuleFilterCacheUpdate();
     return Plugin_Handled;
 }
+
+/*
+ * Log natives API.
+ */
+
+/**
+ * Registers a log module for the calling plugin.
+ *
+ * native int ZP_RegisterLogModule(name, title);
+ **/
+public int API_RegisterLogModule(Handle isPlugin, const int iNumParams)
+{
+    // Gets the names
+    static char sName[SMALL_LINE_LENGTH]; static char sTitle[SMALL_LINE_LENGTH];
+    GetNativeString(1, sName, sizeof(sName)); GetNativeString(2, sTitle, sizeof(sTitle));
+
+    // Validate name
+    if(!strlen(sName))
+    {
+        LogEvent(false, LogType_Native, LOG_CORE_EVENTS, LogModule_Native, "Native Validation", "Can't register log module with an empty name");
+        return -1;
+    }
+
+    // Register the module
+    LogModules iModule = LogRegisterModule(sName, strlen(sTitle) ? sTitle : sName);
+
+    // Validate registry size
+    if(iModule == LogModule_Invalid)
+    {
+        LogEvent(false, LogType_Native, LOG_CORE_EVENTS, LogModule_Native, "Native Validation", "Unable to register log module \"%s\", maximum amount of modules is %d", sName, LOG_MODULE_MAX);
+        return -1;
+    }
+    
+    // Return the id
+    return view_as<int>(iModule);
+}
+
+/**
+ * Prints a formatted message to logs depending on log settings.
+ *
+ * native void ZP_LogEvent(module, flags, description, message, ...);
+ **/
+public int API_LogEvent(Handle isPlugin, const int iNumParams)
+{
+    // Gets the module id
+    int iD = GetNativeCell(1);
+
+    // Validate module
+    if(iD <= 0 || iD >= arrayLogModuleNames.Length)
+    {
+        LogEvent(false, LogType_Native, LOG_CORE_EVENTS, LogModule_Native, "Native Validation", "Invalid the log module index (%d)", iD);
+        return -1;
+    }
+
+    // Check filters before formatting
+    if(!LogCheckEvent(false, LogType_Normal, GetNativeCell(2), view_as<LogModules>(iD)))
+    {
+        return 0;
+    }
+
+    // Format extra parameters into the log buffer
+    static char sDescription[SMALL_LINE_LENGTH]; static char sLogBuffer[LOG_MAX_LENGTH_FILE];
+    GetNativeString(3, sDescription, sizeof(sDescription));
+    FormatNativeString(0, 4, 5, sizeof(sLogBuffer), _, sLogBuffer);
+
+    // Write the message
+    LogEventWrite(LogType_Normal, view_as<LogModules>(iD), sDescription, sLogBuffer);
+    return 0;
+}
@@ -63,10 +63,14 @@ enum CvarsList
     ConVar:CVAR_GAME_CUSTOM_HITGROUPS,
     ConVar:CVAR_GAME_CUSTOM_COSTUMES,
     ConVar:CVAR_GAME_CUSTOM_DATABASE,
+    ConVar:CVAR_GAME_CUSTOM_DATABASE_TOP,
+    ConVar:CVAR_GAME_CUSTOM_DATABASE_RATE,
     ConVar:CVAR_GAME_CUSTOM_MENU_BUTTON,
     ConVar:CVAR_GAME_CUSTOM_SKILL_BUTTON,
     ConVar:CVAR_GAME_CUSTOM_LIGHT_BUTTON,
     ConVar:CVAR_GAME_CUSTOM_SOUND_LEVEL,
+    ConVar:CVAR_GAME_CUSTOM_KILLFEED,
+    ConVar:CVAR_GAME_CUSTOM_CLASS_BUDGET,
     ConVar:CVAR_CONFIG_PATH_DOWNLOADS,
     ConVar:CVAR_CONFIG_PATH_HITGROUPS,
     ConVar:CVAR_CONFIG_PATH_SOUNDS,
@@ -80,9 +84,14 @@ enum CvarsList
     ConVar:CVAR_LOG_IGNORE_CONSOLE,
     ConVar:CVAR_LOG_ERROR_OVERRIDE,
     ConVar:CVAR_LOG_PRINT_CHAT,
+    ConVar:CVAR_LOG_FLAGS,
+    ConVar:CVAR_LOG_BUFFER,
+    ConVar:CVAR_DEBUG_PROFILE,
     ConVar:CVAR_JUMPBOOST_ENABLE,
     ConVar:CVAR_JUMPBOOST_MULTIPLIER,
     ConVar:CVAR_JUMPBOOST_MAX,
+    ConVar:CVAR_KNOCKBACK_STACK,
+    ConVar:CVAR_KNOCKBACK_MAX,
     ConVar:CVAR_HUMAN_CLASS_MENU,
     ConVar:CVAR_HUMAN_ARMOR_PROTECT,
     ConVar:CVAR_HUMAN_LAST_INFECTION,
@@ -158,6 +167,8 @@ enum CvarsList
     ConVar:CVAR_RESPAWN_SUICIDE,
     ConVar:CVAR_RESPAWN_AMOUNT,
     ConVar:CVAR_RESPAWN_TIME,
+    ConVar:CVAR_RESPAWN_BUDGET,
+    ConVar:CVAR_RESPAWN_WAVE,
     ConVar:CVAR_RESPAWN_WORLD,
     ConVar:CVAR_RESPAWN_LAST,
     ConVar:CVAR_RESPAWN_ZOMBIE,
@@ -281,6 +292,64 @@ enum CvarsList
  **/
 ConVar gCvarList[CvarsList];
 
+/**
+ * List of cvar values, which are mirrored for the hot paths.
+ **/
+enum CvarsMirror
+{
+    bool:Mirror_GameCustomModels,
+    Mirror_GameCustomStart,
+    bool:Mirror_GameCustomHitgroups,
+    Mirror_GameCustomSoundLevel,
+    Mirror_GameCustomKillfeed,
+    bool:Mirror_JumpBoostEnable,
+    Float:Mirror_JumpBoostMultiplier,
+    Float:Mirror_JumpBoostMax,
+    Mirror_KnockBackStack,
+    Float:Mirror_KnockBackMax,
+    bool:Mirror_HumanArmorProtect,
+    bool:Mirror_HumanLastInfection,
+    Mirror_HumanInfAmmunition,
+    Mirror_SurvivorInfAmmunition,
+    Float:Mirror_NemesisGravity,
+    bool:Mirror_NemesisKnockBack,
+    Mirror_LeapZombie,
+    Float:Mirror_LeapZombieForce,
+    Float:Mirror_LeapZombieCountDown,
+    bool:Mirror_LeapNemesis,
+    Float:Mirror_LeapNemesisForce,
+    Float:Mirror_LeapNemesisCountDown,
+    bool:Mirror_LeapSurvivor,
+    Float:Mirror_LeapSurvivorForce,
+    Float:Mirror_LeapSurvivorCountDown,
+    Mirror_BonusDamageHuman,
+    Mirror_BonusDamageZombie,
+    Mirror_BonusDamageSurvivor,
+    bool:Mirror_LevelSystem,
+    Float:Mirror_LevelDamageRatio,
+    Mirror_LevelDamageHuman,
+    Mirror_LevelDamageZombie,
+    Mirror_LevelDamageSurvivor,
+    bool:Mirror_MessagesHelp,
+    bool:Mirror_Log,
+    Mirror_LogFlags,
+    bool:Mirror_DebugProfile
+};
+
+/**
+ * Array to store the mirrored cvar values.
+ **/
+int gCvarMirror[CvarsMirror];
+
+/**
+ * Reads the mirrored cvar value. With USE_CVARS_ASSERT each read is validated against the cvar.
+ **/
+#if defined USE_CVARS_ASSERT
+    #define CVAR_MIRROR(%0) (CvarsMirrorAssert(%0) ? gCvarMirror[%0] : gCvarMirror[%0])
+#else
+    #define CVAR_MIRROR(%0) gCvarMirror[%0]
+#endif
+
 /**
  * Cvars module init function.
  **/
@@ -291,13 +360,21 @@ void CvarsInit(/*void*/)
     
     // Hook cvars
     CvarsHook();
+    
+    // Create the mirror of cvars, it is hooked before the modules hooks
+    CvarsMirrorInit();
 
     // Create revision cvar
     CreateConVar("zombieplague_revision", PLUGIN_VERSION, "Revision number for this plugin in source code repository.", FCVAR_SPONLY|FCVAR_UNLOGGED|FCVAR_DONTRECORD|FCVAR_REPLICATED|FCVAR_NOTIFY);
 
     // Forward event to modules
+    CommandsOnCvarInit();
+    ToolsOnCvarInit();
+    WeaponsOnCvarInit();
     VEffectsOnCvarInit();
     VersionOnCvarInit();
+    DebugOnCvarInit();
+    DataBaseOnCvarInit();
 }
 
 /**
@@ -347,10 +424,14 @@ void CvarsCreate(/*void*/)
     gCvarList[CVAR_GAME_CUSTOM_HITGROUPS]       = CreateConVar("zp_game_custom_hitgroups",          "1",                                                               "Enable hitgroups module, disabling this will disable hitgroup-related features. (hitgroup knockback multipliers, hitgroup damage control) [0-no // 1-yes]");
     gCvarList[CVAR_GAME_CUSTOM_COSTUMES]        = CreateConVar("zp_game_custom_costumes",           "1",                                                               "Enable costumes module, disabling this will disable costumes-related features. (hats on the players) [0-no // 1-yes]");
     gCvarList[CVAR_GAME_CUSTOM_DATABASE]        = CreateConVar("zp_game_custom_database",           "1",                                                               "Enable auto saving of players data in the database [0-off // 1-always // 2-map]");
+    gCvarList[CVAR_GAME_CUSTOM_DATABASE_TOP]    = CreateConVar("zp_game_custom_database_top",       "10",                                                              "Amount of players in the cached top list (!ztop)");
+    gCvarList[CVAR_GAME_CUSTOM_DATABASE_RATE]   = CreateConVar("zp_game_custom_database_rate",      "60.0",                                                            "Interval in seconds to refresh the cached top list and ranks (!ztop, !zrank)");
     gCvarList[CVAR_GAME_CUSTOM_MENU_BUTTON]     = CreateConVar("zp_game_custom_menu_button",        "autobuy",                                                         "Bind of the button for the menu open. Look here: https://www.reddit.com/r/GlobalOffensive/comments/36cjph/default_binds/");
     gCvarList[CVAR_GAME_CUSTOM_SKILL_BUTTON]    = CreateConVar("zp_game_custom_skill_button",       "rebuy",                                                           "Bind of the button for the skill usage. Look here: https://www.reddit.com/r/GlobalOffensive/comments/36cjph/default_binds/");
     gCvarList[CVAR_GAME_CUSTOM_LIGHT_BUTTON]    = CreateConVar("zp_game_custom_light_button",       "+lookatweapon",                                                   "Bind of the button for the flashlight trigger. Look here: https://www.reddit.com/r/GlobalOffensive/comments/36cjph/default_binds/");
     gCvarList[CVAR_GAME_CUSTOM_SOUND_LEVEL]     = CreateConVar("zp_game_custom_sound_level",        "75",                                                              "Index of the sound level for the modification");
+    gCvarList[CVAR_GAME_CUSTOM_KILLFEED]        = CreateConVar("zp_game_custom_killfeed",           "0",                                                               "Maximum amount of the infection killfeed entries, which sent in one frame, others are sent in the next frames [0-unlimited]");
+    gCvarList[CVAR_GAME_CUSTOM_CLASS_BUDGET]    = CreateConVar("zp_game_custom_class_budget",       "2.0",                                                             "Time budget in milliseconds per frame to apply models, sounds, effects and huds after a mass infection on the mode start [0.0-apply in the same frame]");
 
     // =========================== //
     //           Configs           //
@@ -372,6 +453,9 @@ void CvarsCreate(/*void*/)
     gCvarList[CVAR_LOG_IGNORE_CONSOLE]          = CreateConVar("zp_log_ignore_console",             "0",                                                               "Don't log events triggered by console commands that are executed by the console itself, like commands in configs [0-no // 1-yes]");
     gCvarList[CVAR_LOG_ERROR_OVERRIDE]          = CreateConVar("zp_log_error_override",             "1",                                                               "Always log error messages no matter what logging flags or modules filters that are enabled [0-no // 1-yes]");
     gCvarList[CVAR_LOG_PRINT_CHAT]              = CreateConVar("zp_log_print_chat",                 "0",                                                               "Print log events to public chat in addition to the log file [0-no // 1-yes]");
+    gCvarList[CVAR_LOG_FLAGS]                   = CreateConVar("zp_log_flags",                      "7",                                                               "Logging flags, add up the values: [1-core events // 2-game events // 4-player commands // 8-debug // 16-debug detail]");
+    gCvarList[CVAR_LOG_BUFFER]                  = CreateConVar("zp_log_buffer",                     "256",                                                             "Amount of the log lines, which are buffered in memory and written once per second, others are dropped and counted [0-write immediately]");
+    gCvarList[CVAR_DEBUG_PROFILE]               = CreateConVar("zp_debug_profile",                  "0",                                                               "Enable timing of the main hooks and forwards, see zp_perf command [0-no // 1-yes]");
 
     // =========================== //
     //          Jump boost         //
@@ -380,6 +464,12 @@ void CvarsCreate(/*void*/)
     gCvarList[CVAR_JUMPBOOST_MULTIPLIER]        = CreateConVar("zp_jumpboost_multiplier",           "1.1",                                                             "Multiplier with power of jump");
     gCvarList[CVAR_JUMPBOOST_MAX]               = CreateConVar("zp_jumpboost_max",                  "300.0",                                                           "Maximum speed, which allow to increse jump");
 
+    // =========================== //
+    //          Knockback          //
+    // =========================== //
+    gCvarList[CVAR_KNOCKBACK_STACK]             = CreateConVar("zp_knockback_stack",                "1",                                                               "Rule of combining knockbacks received by a victim in one frame [0-strongest only // 1-sum all // 2-last only]");
+    gCvarList[CVAR_KNOCKBACK_MAX]               = CreateConVar("zp_knockback_max",                  "1000.0",                                                          "Maximum speed of knockback, which applied to a victim in one frame [0-unlimited]");
+
     // =========================== //
     //           Humans            //
     // =========================== //
@@ -486,6 +576,8 @@ void CvarsCreate(/*void*/)
     gCvarList[CVAR_RESPAWN_SUICIDE]             = CreateConVar("zp_suicide",                        "0",                                                               "Allow kill or suicide command [0-no // 1-yes]");
     gCvarList[CVAR_RESPAWN_AMOUNT]              = CreateConVar("zp_respawn_amount",                 "5",                                                               "Times of respawn for zombie on normal infection mode"); 
     gCvarList[CVAR_RESPAWN_TIME]                = CreateConVar("zp_respawn_time",                   "5.0",                                                             "Delay before respawning on deathmatch mode in seconds"); 
+    gCvarList[CVAR_RESPAWN_BUDGET]              = CreateConVar("zp_respawn_budget",                 "4",                                                               "Maximum amount of respawns in one frame [0-unlimited]");
+    gCvarList[CVAR_RESPAWN_WAVE]                = CreateConVar("zp_respawn_wave",                   "0.0",                                                             "Group respawns into waves with this interval in seconds [0.0-disabled]");
     gCvarList[CVAR_RESPAWN_WORLD]               = CreateConVar("zp_respawn_on_suicide",             "1",                                                               "Respawn players if they commited suicide [0-no // 1-yes]");
     gCvarList[CVAR_RESPAWN_LAST]                = CreateConVar("zp_respawn_after_last_human",       "1",                                                               "Respawn players if only the last human/zombie is left [0-no // 1-yes]"); 
     gCvarList[CVAR_RESPAWN_ZOMBIE]              = CreateConVar("zp_respawn_zombies",                "1",                                                               "Whether to respawn killed zombies [0-no // 1-yes]");
@@ -608,7 +700,7 @@ void CvarsCreate(/*void*/)
     //            Messages         //
     // =========================== //
     gCvarList[CVAR_MESSAGES_HELP]               = CreateConVar("zp_messages_help",                  "1",                                                               "Enable help messages [0-no // 1-yes]");
-    gCvarList[CVAR_MESSAGES_BLOCK]              = CreateConVar("zp_messages_block",                 "Player_Cash_Award_Team_Cash_Award_Player_Point_Award_Match_Will_Start_Chat_SavePlayer_YouDroppedWeapon_CannotDropWeapon", "List of standart engine messages and notifications for blocking. Look here: ../Counter-Strike Global Offensive/csgo/resource/csgo_*.txt");
+    gCvarList[CVAR_MESSAGES_BLOCK]              = CreateConVar("zp_messages_block",                 "Player_Cash_Award_Killed_Enemy,Player_Cash_Award_Killed_Enemy_Generic,Player_Point_Award_Killed_Enemy,Player_Point_Award_Killed_Enemy_Plural,Player_Point_Award_Assist_Enemy,Player_Point_Award_Assist_Enemy_Plural,Team_Cash_Award_Win_Time,Team_Cash_Award_Loser_Bonus,Team_Cash_Award_Loser_Bonus_Neg,Team_Cash_Award_no_income,Match_Will_Start_Chat,Chat_SavePlayer_Saved,Chat_SavePlayer_Savior,Chat_SavePlayer_Spectator,SFUI_Notice_YouDroppedWeapon,SFUI_Notice_CannotDropWeapon", "Comma separated list of exact engine message keys for blocking, without the '#' prefix. Look here: ../Counter-Strike Global Offensive/csgo/resource/csgo_*.txt");
 
     // =========================== //
     //     Additional settings     //
@@ -705,6 +797,137 @@ void CvarsHook(/*void*/)
     //HookConVarChange(gCvarList[CVAR_ZOMBIE_XRAY],             CvarsHookZombieVision);
 }
 
+/**
+ * Hook the mirrored cvars and read their values.
+ **/
+void CvarsMirrorInit(/*void*/)
+{
+    // Hook mirrored cvars
+    HookConVarChange(gCvarList[CVAR_GAME_CUSTOM_MODELS],      CvarsOnMirrorHook);
+    HookConVarChange(gCvarList[CVAR_GAME_CUSTOM_START],       CvarsOnMirrorHook);
+    HookConVarChange(gCvarList[CVAR_GAME_CUSTOM_HITGROUPS],   CvarsOnMirrorHook);
+    HookConVarChange(gCvarList[CVAR_GAME_CUSTOM_SOUND_LEVEL], CvarsOnMirrorHook);
+    HookConVarChange(gCvarList[CVAR_GAME_CUSTOM_KILLFEED],    CvarsOnMirrorHook);
+    HookConVarChange(gCvarList[CVAR_JUMPBOOST_ENABLE],        CvarsOnMirrorHook);
+    HookConVarChange(gCvarList[CVAR_JUMPBOOST_MULTIPLIER],    CvarsOnMirrorHook);
+    HookConVarChange(gCvarList[CVAR_JUMPBOOST_MAX],           CvarsOnMirrorHook);
+    HookConVarChange(gCvarList[CVAR_KNOCKBACK_STACK],         CvarsOnMirrorHook);
+    HookConVarChange(gCvarList[CVAR_KNOCKBACK_MAX],           CvarsOnMirrorHook);
+    HookConVarChange(gCvarList[CVAR_HUMAN_ARMOR_PROTECT],     CvarsOnMirrorHook);
+    HookConVarChange(gCvarList[CVAR_HUMAN_LAST_INFECTION],    CvarsOnMirrorHook);
+    HookConVarChange(gCvarList[CVAR_HUMAN_INF_AMMUNITION],    CvarsOnMirrorHook);
+    HookConVarChange(gCvarList[CVAR_SURVIVOR_INF_AMMUNITION], CvarsOnMirrorHook);
+    HookConVarChange(gCvarList[CVAR_NEMESIS_GRAVITY],         CvarsOnMirrorHook);
+    HookConVarChange(gCvarList[CVAR_NEMESIS_KNOCKBACK],       CvarsOnMirrorHook);
+    HookConVarChange(gCvarList[CVAR_LEAP_ZOMBIE],             CvarsOnMirrorHook);
+    HookConVarChange(gCvarList[CVAR_LEAP_ZOMBIE_FORCE],       CvarsOnMirrorHook);
+    HookConVarChange(gCvarList[CVAR_LEAP_ZOMBIE_COUNTDOWN],   CvarsOnMirrorHook);
+    HookConVarChange(gCvarList[CVAR_LEAP_NEMESIS],            CvarsOnMirrorHook);
+    HookConVarChange(gCvarList[CVAR_LEAP_NEMESIS_FORCE],      CvarsOnMirrorHook);
+    HookConVarChange(gCvarList[CVAR_LEAP_NEMESIS_COUNTDOWN],  CvarsOnMirrorHook);
+    HookConVarChange(gCvarList[CVAR_LEAP_SURVIVOR],           CvarsOnMirrorHook);
+    HookConVarChange(gCvarList[CVAR_LEAP_SURVIVOR_FORCE],     CvarsOnMirrorHook);
+    HookConVarChange(gCvarList[CVAR_LEAP_SURVIVOR_COUNTDOWN], CvarsOnMirrorHook);
+    HookConVarChange(gCvarList[CVAR_BONUS_DAMAGE_HUMAN],      CvarsOnMirrorHook);
+    HookConVarChange(gCvarList[CVAR_BONUS_DAMAGE_ZOMBIE],     CvarsOnMirrorHook);
+    HookConVarChange(gCvarList[CVAR_BONUS_DAMAGE_SURVIVOR],   CvarsOnMirrorHook);
+    HookConVarChange(gCvarList[CVAR_LEVEL_SYSTEM],            CvarsOnMirrorHook);
+    HookConVarChange(gCvarList[CVAR_LEVEL_DAMAGE_RATIO],      CvarsOnMirrorHook);
+    HookConVarChange(gCvarList[CVAR_LEVEL_DAMAGE_HUMAN],      CvarsOnMirrorHook);
+    HookConVarChange(gCvarList[CVAR_LEVEL_DAMAGE_ZOMBIE],     CvarsOnMirrorHook);
+    HookConVarChange(gCvarList[CVAR_LEVEL_DAMAGE_SURVIVOR],   CvarsOnMirrorHook);
+    HookConVarChange(gCvarList[CVAR_MESSAGES_HELP],           CvarsOnMirrorHook);
+    HookConVarChange(gCvarList[CVAR_LOG],                     CvarsOnMirrorHook);
+    HookConVarChange(gCvarList[CVAR_LOG_FLAGS],               CvarsOnMirrorHook);
+    HookConVarChange(gCvarList[CVAR_DEBUG_PROFILE],           CvarsOnMirrorHook);
+    
+    // Read the values
+    CvarsMirrorRead(gCvarMirror);
+}
+
+/**
+ * Reads the mirrored cvar values.
+ *
+ * @param iMirror           The mirror array.
+ **/
+void CvarsMirrorRead(int iMirror[CvarsMirror])
+{
+    // Gets the values
+    iMirror[Mirror_GameCustomModels]      = gCvarList[CVAR_GAME_CUSTOM_MODELS].BoolValue;
+    iMirror[Mirror_GameCustomStart]       = gCvarList[CVAR_GAME_CUSTOM_START].IntValue;
+    iMirror[Mirror_GameCustomHitgroups]   = gCvarList[CVAR_GAME_CUSTOM_HITGROUPS].BoolValue;
+    iMirror[Mirror_GameCustomSoundLevel]  = gCvarList[CVAR_GAME_CUSTOM_SOUND_LEVEL].IntValue;
+    iMirror[Mirror_GameCustomKillfeed]    = gCvarList[CVAR_GAME_CUSTOM_KILLFEED].IntValue;
+    iMirror[Mirror_JumpBoostEnable]       = gCvarList[CVAR_JUMPBOOST_ENABLE].BoolValue;
+    iMirror[Mirror_JumpBoostMultiplier]   = gCvarList[CVAR_JUMPBOOST_MULTIPLIER].FloatValue;
+    iMirror[Mirror_JumpBoostMax]          = gCvarList[CVAR_JUMPBOOST_MAX].FloatValue;
+    iMirror[Mirror_KnockBackStack]        = gCvarList[CVAR_KNOCKBACK_STACK].IntValue;
+    iMirror[Mirror_KnockBackMax]          = gCvarList[CVAR_KNOCKBACK_MAX].FloatValue;
+    iMirror[Mirror_HumanArmorProtect]     = gCvarList[CVAR_HUMAN_ARMOR_PROTECT].BoolValue;
+    iMirror[Mirror_HumanLastInfection]    = gCvarList[CVAR_HUMAN_LAST_INFECTION].BoolValue;
+    iMirror[Mirror_HumanInfAmmunition]    = gCvarList[CVAR_HUMAN_INF_AMMUNITION].IntValue;
+    iMirror[Mirror_SurvivorInfAmmunition] = gCvarList[CVAR_SURVIVOR_INF_AMMUNITION].IntValue;
+    iMirror[Mirror_NemesisGravity]        = gCvarList[CVAR_NEMESIS_GRAVITY].FloatValue;
+    iMirror[Mirror_NemesisKnockBack]      = gCvarList[CVAR_NEMESIS_KNOCKBACK].BoolValue;
+    iMirror[Mirror_LeapZombie]            = gCvarList[CVAR_LEAP_ZOMBIE].IntValue;
+    iMirror[Mirror_LeapZombieForce]       = gCvarList[CVAR_LEAP_ZOMBIE_FORCE].FloatValue;
+    iMirror[Mirror_LeapZombieCountDown]   = gCvarList[CVAR_LEAP_ZOMBIE_COUNTDOWN].FloatValue;
+    iMirror[Mirror_LeapNemesis]           = gCvarList[CVAR_LEAP_NEMESIS].BoolValue;
+    iMirror[Mirror_LeapNemesisForce]      = gCvarList[CVAR_LEAP_NEMESIS_FORCE].FloatValue;
+    iMirror[Mirror_LeapNemesisCountDown]  = gCvarList[CVAR_LEAP_NEMESIS_COUNTDOWN].FloatValue;
+    iMirror[Mirror_LeapSurvivor]          = gCvarList[CVAR_LEAP_SURVIVOR].BoolValue;
+    iMirror[Mirror_LeapSurvivorForce]     = gCvarList[CVAR_LEAP_SURVIVOR_FORCE].FloatValue;
+    iMirror[Mirror_LeapSurvivorCountDown] = gCvarList[CVAR_LEAP_SURVIVOR_COUNTDOWN].FloatValue;
+    iMirror[Mirror_BonusDamageHuman]      = gCvarList[CVAR_BONUS_DAMAGE_HUMAN].IntValue;
+    iMirror[Mirror_BonusDamageZombie]     = gCvarList[CVAR_BONUS_DAMAGE_ZOMBIE].IntValue;
+    iMirror[Mirror_BonusDamageSurvivor]   = gCvarList[CVAR_BONUS_DAMAGE_SURVIVOR].IntValue;
+    iMirror[Mirror_LevelSystem]           = gCvarList[CVAR_LEVEL_SYSTEM].BoolValue;
+    iMirror[Mirror_LevelDamageRatio]      = gCvarList[CVAR_LEVEL_DAMAGE_RATIO].FloatValue;
+    iMirror[Mirror_LevelDamageHuman]      = gCvarList[CVAR_LEVEL_DAMAGE_HUMAN].IntValue;
+    iMirror[Mirror_LevelDamageZombie]     = gCvarList[CVAR_LEVEL_DAMAGE_ZOMBIE].IntValue;
+    iMirror[Mirror_LevelDamageSurvivor]   = gCvarList[CVAR_LEVEL_DAMAGE_SURVIVOR].IntValue;
+    iMirror[Mirror_MessagesHelp]          = gCvarList[CVAR_MESSAGES_HELP].BoolValue;
+    iMirror[Mirror_Log]                   = gCvarList[CVAR_LOG].BoolValue;
+    iMirror[Mirror_LogFlags]              = gCvarList[CVAR_LOG_FLAGS].IntValue;
+    iMirror[Mirror_DebugProfile]          = gCvarList[CVAR_DEBUG_PROFILE].BoolValue;
+}
+
+/**
+ * Cvar hook callback.
+ * Updates the mirror of cvars.
+ * 
+ * @param hConVar           The cvar handle.
+ * @param oldValue          The value before the attempted change.
+ * @param newValue          The new value.
+ **/
+public void CvarsOnMirrorHook(ConVar hConVar, const char[] oldValue, const char[] newValue)
+{
+    // Read the values
+    CvarsMirrorRead(gCvarMirror);
+}
+
+/**
+ * Validates the mirrored cvar value. (Debug)
+ *
+ * @param iField            The mirror field.
+ * @return                  Always true, a stale value is logged.
+ **/
+stock bool CvarsMirrorAssert(any iField)
+{
+    // Read the current values
+    static int iMirror[CvarsMirror];
+    CvarsMirrorRead(iMirror);
+
+    // Validate value
+    if(iMirror[iField] != gCvarMirror[iField])
+    {
+        LogEvent(false, LogType_Error, LOG_CORE_EVENTS, LogModule_Debug, "Cvar Validation", "Stale read of the mirrored cvar (field %d): \"%d\" instead of \"%d\"", iField, gCvarMirror[iField], iMirror[iField]);
+    }
+    
+    // Return on success
+    return true;
+}
+
 /**
  * Cvar hook callback.
  * Prevents changes of the normal cvars.
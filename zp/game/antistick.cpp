@@ -60,25 +60,39 @@
 #define ANTISTICK_DEFAULT_HULL_WIDTH 32.0
 
 /**
- * List of components that make up the model rectangular boundaries.
- * 
- * F = Front
- * B = Back
- * L = Left
- * R = Right
- * U = Upper
- * D = Down
+ * Height of the model box bottom above the client origin.
+ **/
+#define ANTISTICK_DEFAULT_HULL_BOTTOM 15.0
+
+/**
+ * Interval of the solidify pass.
+ **/
+#define ANTISTICK_SOLIDIFY_INTERVAL 0.1
+
+/**
+ * Arrays to store the model boxes, which are computed once per tick.
+ **/
+float gAntiStickMins[MAXPLAYERS+1][3];
+float gAntiStickMaxs[MAXPLAYERS+1][3];
+int gAntiStickTick[MAXPLAYERS+1];
+
+/**
+ * Array to store the clients, which are waiting for the collisions back.
+ **/
+bool gAntiStickPending[MAXPLAYERS+1];
+
+/**
+ * Timer of the solidify pass.
  **/
-enum AntiStickBoxBound
+Handle hAntiStickTimer = INVALID_HANDLE;
+
+/**
+ * Purge the solidify pass on the map end.
+ **/
+void AntiStickPurge(/*void*/)
 {
-    BoxBound_FUR = 0, /** Front upper right */
-    BoxBound_FUL,     /** etc.. */
-    BoxBound_FDR,
-    BoxBound_FDL,
-    BoxBound_BUR,
-    BoxBound_BUL,
-    BoxBound_BDR,
-    BoxBound_BDL,
+    // Purge the timer
+    hAntiStickTimer = INVALID_HANDLE; /// with flag TIMER_FLAG_NO_MAPCHANGE
 }
 
 /**
@@ -88,6 +102,10 @@ enum AntiStickBoxBound
  **/
 void AntiStickClientInit(const int clientIndex)
 {
+    // Resets the client data
+    gAntiStickPending[clientIndex] = false;
+    gAntiStickTick[clientIndex] = -1;
+    
     // Hook entity callbacks
     SDKHook(clientIndex, SDKHook_StartTouch, AntiStickStartTouch);
 }
@@ -145,196 +163,170 @@ public void AntiStickStartTouch(const int clientIndex, const int entityIndex)
     // If the client is in any other collision group than "off", than we must set them to off, to unstick
     if(collisionGroup != ANTISTICK_COLLISIONS_OFF)
     {
-        // Disable collisions to unstick, and start timers to re-solidify
+        // Disable collisions to unstick, and queue the client for the solidify pass
         AntiStickSetCollisionGroup(clientIndex, ANTISTICK_COLLISIONS_OFF);
-        CreateTimer(0.0, AntiStickSolidifyTimer, GetClientUserId(clientIndex), TIMER_FLAG_NO_MAPCHANGE | TIMER_REPEAT);
+        gAntiStickPending[clientIndex] = true;
+        
+        // Validate timer
+        if(hAntiStickTimer == INVALID_HANDLE)
+        {
+            // Start the solidify pass
+            hAntiStickTimer = CreateTimer(ANTISTICK_SOLIDIFY_INTERVAL, AntiStickSolidifyTimer, _, TIMER_FLAG_NO_MAPCHANGE | TIMER_REPEAT);
+        }
     }
 }
 
 /**
- * Callback for solidify timer.
+ * Callback for solidify timer, checks all queued clients in one pass.
  * 
  * @param hTimer            The timer handle.
- * @param userID            The user id.
  **/
-public Action AntiStickSolidifyTimer(Handle hTimer, const int userID)
+public Action AntiStickSolidifyTimer(Handle hTimer)
 {
-    // Gets the client index from the user ID
-    int clientIndex = GetClientOfUserId(userID);
-
-    // Verify that the client is exist
-    if(!clientIndex)
-    {
-        return Plugin_Stop;
-    }
-
-    // If the client collisions are already on, then stop
-    if(AntiStickGetCollisionGroup(clientIndex) == ANTISTICK_COLLISIONS_ON)
-    {
-        return Plugin_Stop;
-    }
-
-    // Loop through all clients and check if client is stuck in them
+    // Initialize the client list
+    static int iClients[MAXPLAYERS+1]; static bool bStuck[MAXPLAYERS+1];
+    int iCount; bool bPending;
+    
+    // i = client index
     for(int i = 1; i <= MaxClients; i++)
     {
+        // Resets the stuck state
+        bStuck[i] = false;
+        
         // If the client is dead, then skip it
         if(!IsPlayerExist(i))
         {
+            // Validate queued client
+            if(gAntiStickPending[i] && IsPlayerExist(i, false))
+            {
+                // Change collisions back to normal
+                AntiStickSetCollisionGroup(i, ANTISTICK_COLLISIONS_ON);
+            }
+            
+            // Remove the client from the queue
+            gAntiStickPending[i] = false;
             continue;
         }
-        
-        // Don't compare the same clients
-        if(clientIndex == i)
+
+        // If the client collisions are already on, then skip it
+        if(gAntiStickPending[i] && AntiStickGetCollisionGroup(i) == ANTISTICK_COLLISIONS_ON)
         {
-            continue;
+            gAntiStickPending[i] = false;
         }
         
-        // If the client is colliding with a client, then allow timer to continue
-        if(AntiStickIsModelBoxColliding(clientIndex, i))
-        {
-            return Plugin_Continue;
-        }
+        // Push the client, and update the box
+        bPending |= gAntiStickPending[i];
+        iClients[iCount++] = i; AntiStickUpdateModelBox(i);
     }
-
-    // Change collisions back to normal
-    AntiStickSetCollisionGroup(clientIndex, ANTISTICK_COLLISIONS_ON);
-
-    // Debug message. May be useful when calibrating antistick
-    LogEvent(true, LogType_Normal, LOG_DEBUG, LogModule_Antistick, "Collision", "Player \"%N\" is no longer intersecting anyone. Applying normal collisions.", clientIndex);
-    return Plugin_Stop;
-}
-
-/**
- * Build the model box by finding all vertices.
- * 
- * @param clientIndex       The client index.
- * @param boundaries        Array with 'AntiStickBoxBounds' for indexes to return bounds into.
- * @param width             The width of the model box.
- **/
-stock void AntiStickBuildModelBox(const int clientIndex, float boundaries[AntiStickBoxBound][3], const float flWidth)
-{
-    static float vClientLoc[3];
-    static float vTwistAngle[3];
-    static float vCornerAngle[3];
-    static float vSideLoc[3];
-    static float vFinalLoc[4][3];
-
-    // Gets needed vector info
-    GetClientAbsOrigin(clientIndex, vClientLoc);
-
-    // Sets the pitch to 0
-    vTwistAngle[1] = 90.0;
-    vCornerAngle[1] = 0.0;
-
-    for(int x = 0; x < 4; x++)
+    
+    // Validate queue
+    if(!bPending)
     {
-        // Jump to point on player left side.
-        AntiStickJumpToPoint(vClientLoc, vTwistAngle, flWidth / 2, vSideLoc);
-
-        // From this point, jump to the corner, which would be half the width from the middle of a side
-        AntiStickJumpToPoint(vSideLoc, vCornerAngle, flWidth / 2, vFinalLoc[x]);
+        // Clear timer
+        hAntiStickTimer = INVALID_HANDLE;
+        return Plugin_Stop;
+    }
 
-        // Twist 90 degrees to find next side/corner
-        vTwistAngle[1] += 90.0;
-        vCornerAngle[1] += 90.0;
+    // Sort the clients by the box min on X axis
+    SortCustom1D(iClients, iCount, AntiStickSortByMinX);
 
-        // Fix angles
-        if(vTwistAngle[1] > 180.0)
+    // i = sweep index
+    int iActive;
+    for(int i = 0; i < iCount; i++)
+    {
+        // Gets the client index
+        int clientIndex = iClients[i];
+        
+        // x = active index, the list is stored in the front of the sorted list
+        for(int x = iActive - 1; x >= 0; x--)
         {
-            vTwistAngle[1] -= 360.0;
+            // Gets the active client index
+            int activeIndex = iClients[x];
+            
+            // Remove the client, which box ends before the current one on X axis
+            if(gAntiStickMaxs[activeIndex][0] < gAntiStickMins[clientIndex][0])
+            {
+                iClients[x] = iClients[--iActive];
+                continue;
+            }
+
+            // Compare y and z values
+            if(gAntiStickMaxs[activeIndex][1] < gAntiStickMins[clientIndex][1] || gAntiStickMins[activeIndex][1] > gAntiStickMaxs[clientIndex][1] || 
+               gAntiStickMaxs[activeIndex][2] < gAntiStickMins[clientIndex][2] || gAntiStickMins[activeIndex][2] > gAntiStickMaxs[clientIndex][2])
+            {
+                continue;
+            }
+            
+            // They are intersecting
+            bStuck[activeIndex] = true;
+            bStuck[clientIndex] = true;
         }
 
-        if(vCornerAngle[1] > 180.0)
-        {
-            vCornerAngle[1] -= 360.0;
-        }
+        // Push the client into the active list, sorted part is behind the index
+        iClients[iActive++] = clientIndex;
     }
 
-    // Copy all horizontal model box data to array
-    boundaries[BoxBound_FUR][0] = vFinalLoc[3][0];
-    boundaries[BoxBound_FUR][1] = vFinalLoc[3][1];
-    boundaries[BoxBound_FUL][0] = vFinalLoc[0][0];
-    boundaries[BoxBound_FUL][1] = vFinalLoc[0][1];
-    boundaries[BoxBound_FDR][0] = vFinalLoc[3][0];
-    boundaries[BoxBound_FDR][1] = vFinalLoc[3][1];
-    boundaries[BoxBound_FDL][0] = vFinalLoc[0][0];
-    boundaries[BoxBound_FDL][1] = vFinalLoc[0][1];
-    boundaries[BoxBound_BUR][0] = vFinalLoc[2][0];
-    boundaries[BoxBound_BUR][1] = vFinalLoc[2][1];
-    boundaries[BoxBound_BUL][0] = vFinalLoc[1][0];
-    boundaries[BoxBound_BUL][1] = vFinalLoc[1][1];
-    boundaries[BoxBound_BDR][0] = vFinalLoc[2][0];
-    boundaries[BoxBound_BDR][1] = vFinalLoc[2][1];
-    boundaries[BoxBound_BDL][0] = vFinalLoc[1][0];
-    boundaries[BoxBound_BDL][1] = vFinalLoc[1][1];
+    // i = client index
+    for(int i = 1; i <= MaxClients; i++)
+    {
+        // If the client isn't queued or still is stuck, then skip it
+        if(!gAntiStickPending[i] || bStuck[i])
+        {
+            continue;
+        }
 
-    // Sets Z bounds
-    static float vEyeLoc[3];
-    GetClientEyePosition(clientIndex, vEyeLoc);
+        // Change collisions back to normal
+        AntiStickSetCollisionGroup(i, ANTISTICK_COLLISIONS_ON);
+        gAntiStickPending[i] = false;
 
-    boundaries[BoxBound_FUR][2] = vEyeLoc[2];
-    boundaries[BoxBound_FUL][2] = vEyeLoc[2];
-    boundaries[BoxBound_FDR][2] = vClientLoc[2] + 15.0;
-    boundaries[BoxBound_FDL][2] = vClientLoc[2] + 15.0;
-    boundaries[BoxBound_BUR][2] = vEyeLoc[2];
-    boundaries[BoxBound_BUL][2] = vEyeLoc[2];
-    boundaries[BoxBound_BDR][2] = vClientLoc[2] + 15.0;
-    boundaries[BoxBound_BDL][2] = vClientLoc[2] + 15.0;
+        // Debug message. May be useful when calibrating antistick
+        LogEvent(true, LogType_Normal, LOG_DEBUG, LogModule_Antistick, "Collision", "Player \"%N\" is no longer intersecting anyone. Applying normal collisions.", i);
+    }
+    
+    // Allow timer
+    return Plugin_Continue;
 }
 
 /**
- * Jumps from a point to another based off angle and distance.
- * 
- * @param flVector          Point to jump from.
- * @param flAngle           Angle to base jump off of.
- * @param flDistance        Distance to jump
- * @param flResult          Resultant point.
+ * Sort callback, compares the box min on X axis.
  **/
-stock void AntiStickJumpToPoint(const float vVector[3], const float vAngle[3], const float flDistance, float vResult[3])
+public int AntiStickSortByMinX(int elem1, int elem2, const int[] array, Handle hndl)
 {
-    static float vViewVector[3];
-    
-    // Turn client angle, into a vector
-    GetAngleVectors(vAngle, vViewVector, NULL_VECTOR, NULL_VECTOR);
-    
-    // Normalize vector
-    NormalizeVector(vViewVector, vViewVector);
-    
-    // Scale to the given distance
-    ScaleVector(vViewVector, flDistance);
-    
-    // Add the vectors together
-    AddVectors(vVector, vViewVector, vResult);
+    // Compare values
+    if(gAntiStickMins[elem1][0] < gAntiStickMins[elem2][0]) return -1;
+    if(gAntiStickMins[elem1][0] > gAntiStickMins[elem2][0]) return 1;
+    return 0;
 }
 
 /**
- * Get the max/min value of a 3D box on any axis.
+ * Update the axis-aligned model box, once per tick.
  * 
- * @param Axis              The axis to check.
- * @param boundaries        The boundaries to check.
- * @param iMin              Return the min value instead.
+ * @param clientIndex       The client index.
  **/
-stock float AntiStickGetBoxMaxBoundary(const int Axis, const float boundaries[AntiStickBoxBound][3],const bool iMin = false)
+stock void AntiStickUpdateModelBox(const int clientIndex)
 {
-    // Create 'outlier' with initial value of first boundary
-    float outlier = boundaries[0][Axis];
-    
-    // x = Boundary index. (Start at 1 because we initialized 'outlier' with the 0 index value)
-    int iSize = sizeof(boundaries);
-    for(int x = 1; x < iSize; x++)
+    // Validate tick
+    int iTick = GetGameTickCount();
+    if(gAntiStickTick[clientIndex] == iTick)
     {
-        if(!iMin && boundaries[x][Axis] > outlier)
-        {
-            outlier = boundaries[x][Axis];
-        }
-        else if(iMin && boundaries[x][Axis] < outlier)
-        {
-            outlier = boundaries[x][Axis];
-        }
+        return;
     }
+    gAntiStickTick[clientIndex] = iTick;
     
-    // Return value
-    return outlier;
+    // Gets needed vector info
+    static float vClientLoc[3]; static float vEyeLoc[3];
+    GetClientAbsOrigin(clientIndex, vClientLoc);
+    GetClientEyePosition(clientIndex, vEyeLoc);
+
+    // Sets the horizontal bounds
+    gAntiStickMins[clientIndex][0] = vClientLoc[0] - ANTISTICK_DEFAULT_HULL_WIDTH / 2;
+    gAntiStickMins[clientIndex][1] = vClientLoc[1] - ANTISTICK_DEFAULT_HULL_WIDTH / 2;
+    gAntiStickMaxs[clientIndex][0] = vClientLoc[0] + ANTISTICK_DEFAULT_HULL_WIDTH / 2;
+    gAntiStickMaxs[clientIndex][1] = vClientLoc[1] + ANTISTICK_DEFAULT_HULL_WIDTH / 2;
+    
+    // Sets Z bounds
+    gAntiStickMins[clientIndex][2] = vClientLoc[2] + ANTISTICK_DEFAULT_HULL_BOTTOM;
+    gAntiStickMaxs[clientIndex][2] = vEyeLoc[2];
 }
 
 /**
@@ -346,44 +338,18 @@ stock float AntiStickGetBoxMaxBoundary(const int Axis, const float boundaries[An
  **/
 stock bool AntiStickIsModelBoxColliding(const int client1, const int client2)
 {
-    float client1modelbox[AntiStickBoxBound][3];
-    float client2modelbox[AntiStickBoxBound][3];
+    // Update model boxes for each client
+    AntiStickUpdateModelBox(client1);
+    AntiStickUpdateModelBox(client2);
     
-    // Build model boxes for each client
-    AntiStickBuildModelBox(client1, client1modelbox, ANTISTICK_DEFAULT_HULL_WIDTH);
-    AntiStickBuildModelBox(client2, client2modelbox, ANTISTICK_DEFAULT_HULL_WIDTH);
-    
-    // Compare x values
-    float max1x = AntiStickGetBoxMaxBoundary(0, client1modelbox);
-    float max2x = AntiStickGetBoxMaxBoundary(0, client2modelbox);
-    float min1x = AntiStickGetBoxMaxBoundary(0, client1modelbox, true);
-    float min2x = AntiStickGetBoxMaxBoundary(0, client2modelbox, true);
-    
-    if(max1x < min2x || min1x > max2x)
-    {
-        return false;
-    }
-    
-    // Compare y values
-    float max1y = AntiStickGetBoxMaxBoundary(1, client1modelbox);
-    float max2y = AntiStickGetBoxMaxBoundary(1, client2modelbox);
-    float min1y = AntiStickGetBoxMaxBoundary(1, client1modelbox, true);
-    float min2y = AntiStickGetBoxMaxBoundary(1, client2modelbox, true);
-    
-    if(max1y < min2y || min1y > max2y)
+    // i = axis
+    for(int i = 0; i < 3; i++)
     {
-        return false;
-    }
-    
-    // Compare z values
-    float max1z = AntiStickGetBoxMaxBoundary(2, client1modelbox);
-    float max2z = AntiStickGetBoxMaxBoundary(2, client2modelbox);
-    float min1z = AntiStickGetBoxMaxBoundary(2, client1modelbox, true);
-    float min2z = AntiStickGetBoxMaxBoundary(2, client2modelbox, true);
-    
-    if(max1z < min2z || min1z > max2z)
-    {
-        return false;
+        // Compare values
+        if(gAntiStickMaxs[client1][i] < gAntiStickMins[client2][i] || gAntiStickMins[client1][i] > gAntiStickMaxs[client2][i])
+        {
+            return false;
+        }
     }
     
     // They are intersecting
@@ -25,6 +25,58 @@
  * ============================================================================
  **/
 
+/**
+ * Class presentation queue data block.
+ **/
+enum ClassQueueData
+{
+    Class_Client,
+    Class_UserID,
+    bool:Class_Zombie,
+    bool:Class_Special,
+    bool:Class_Respawn
+}
+
+/**
+ * Array to store the queued presentation of the batch.
+ **/
+ArrayList arrayClassQueue;
+
+/**
+ * Indicates that the classes are set by the batch, and the pending frame of the queue drain.
+ **/
+bool gClassBatch;
+bool gClassQueueFrame;
+
+/**
+ * Initialize the class queue.
+ **/
+void ClassInit(/*void*/)
+{
+    // Initialize the array of blocks
+    arrayClassQueue = CreateArray(view_as<int>(ClassQueueData));
+}
+
+/**
+ * Purge the class queue on the map end.
+ **/
+void ClassPurge(/*void*/)
+{
+    // Clear the list
+    arrayClassQueue.Clear();
+}
+
+/**
+ * Begin or end the batch of class changes, which presentation is spread across frames.
+ *
+ * @param bBatch            True to begin the batch, false to end.
+ **/
+void ClassSetBatch(const bool bBatch)
+{
+    // Sets the batch
+    gClassBatch = bBatch;
+}
+
 /**
  * Infects a client.
  *
@@ -55,6 +107,9 @@ void ClassMakeZombie(const int victimIndex, const int attackerIndex = 0, const b
         ToolsSetClientScore(victimIndex, true, ToolsGetClientScore(victimIndex, true) + 1);
         ToolsSetClientScore(victimIndex, false, ToolsGetClientScore(victimIndex, false) + 1);
         
+        // Increment infections of the stats
+        gClientData[attackerIndex][Client_Infections]++;
+        
         // Increment exp and bonuses
         ToolsSetClientHealth(attackerIndex, GetClientHealth(attackerIndex) + gCvarList[CVAR_BONUS_INFECT_HEALTH].IntValue);
         AccountSetClientCash(attackerIndex, gClientData[attackerIndex][Client_AmmoPacks] + gCvarList[CVAR_BONUS_INFECT].IntValue);
@@ -74,6 +129,7 @@ void ClassMakeZombie(const int victimIndex, const int attackerIndex = 0, const b
     
     // Resets some tools
     ToolsResetTimers(victimIndex);
+    TasksOnClientClass(victimIndex);
     ToolsSetClientDetecting(victimIndex, false);
     ToolsSetClientFlashLight(victimIndex, false);
     ToolsSetClientHud(victimIndex, gCvarList[CVAR_ZOMBIE_CROSSHAIR].BoolValue);
@@ -86,12 +142,9 @@ void ClassMakeZombie(const int victimIndex, const int attackerIndex = 0, const b
     gClientData[victimIndex][Client_SkillCountDown] = 0.0;
 
     //*********************************************************************
-    //*       UPDATE MODELS AND SET ZOMBIE/NEMESIS CLASS PROPERTIES       *
+    //*              SET ZOMBIE/NEMESIS CLASS PROPERTIES                  *
     //*********************************************************************
     
-    // Initialize model char
-    static char sModel[PLATFORM_MAX_PATH];
-    
     // Sets nemesis properties
     if(nemesisMode)
     {
@@ -117,9 +170,6 @@ void ClassMakeZombie(const int victimIndex, const int attackerIndex = 0, const b
         ToolsSetClientLMV(victimIndex, gCvarList[CVAR_NEMESIS_SPEED].FloatValue); 
         ToolsSetClientGravity(victimIndex, gCvarList[CVAR_NEMESIS_GRAVITY].FloatValue);
         ToolsSetClientArmor(victimIndex, 0);
-        
-        // Gets nemesis model
-        gCvarList[CVAR_NEMESIS_PLAYER_MODEL].GetString(sModel, sizeof(sModel));
     }
     
     // Sets zombie properties
@@ -142,49 +192,23 @@ void ClassMakeZombie(const int victimIndex, const int attackerIndex = 0, const b
         ToolsSetClientLMV(victimIndex, ZombieGetSpeed(gClientData[victimIndex][Client_ZombieClass]) + (gCvarList[CVAR_LEVEL_SYSTEM].BoolValue ? (gCvarList[CVAR_LEVEL_SPEED_RATIO].FloatValue * float(gClientData[victimIndex][Client_Level])) : 0.0));
         ToolsSetClientGravity(victimIndex, ZombieGetGravity(gClientData[victimIndex][Client_ZombieClass]) + (gCvarList[CVAR_LEVEL_SYSTEM].BoolValue ? (gCvarList[CVAR_LEVEL_GRAVITY_RATIO].FloatValue * float(gClientData[victimIndex][Client_Level])) : 0.0));
         ToolsSetClientArmor(victimIndex, 0);
-        
-        // Gets zombie model
-        ZombieGetModel(gClientData[victimIndex][Client_ZombieClass], sModel, sizeof(sModel));
-
-        // If help messages enable, then show 
-        if(gCvarList[CVAR_MESSAGES_HELP].BoolValue)
-        {
-            // Gets zombie info
-            static char sInfo[BIG_LINE_LENGTH];
-            ZombieGetInfo(gClientData[victimIndex][Client_ZombieClass], sInfo, sizeof(sInfo));
-            
-            // Show zombie personal info
-            if(strlen(sInfo)) TranslationPrintHintText(victimIndex, sInfo);
-        }
-        
-        // If instant class menu enable, then show 
-        if(gCvarList[CVAR_ZOMBIE_CLASS_MENU].BoolValue)
-        {
-            // Open the zombie classes menu
-            ZombieMenu(victimIndex, true);
-        }
     }
 
-    // Apply model
-    if(strlen(sModel)) SetEntityModel(victimIndex, sModel);
-
     // Forward event to modules
     SkillsOnClientInfected(victimIndex, nemesisMode);
-    SoundsOnClientInfected(victimIndex, respawnMode);
-    VEffectsOnClientInfected(victimIndex, nemesisMode, respawnMode);
-    LevelSystemOnClientUpdate(victimIndex);
-    if(gCvarList[CVAR_ZOMBIE_NIGHT_VISION]) VOverlayOnClientUpdate(victimIndex, Overlay_Vision);
-    RequestFrame(view_as<RequestFrameCallback>(AccountOnClientUpdate), GetClientUserId(victimIndex));
     RequestFrame(view_as<RequestFrameCallback>(WeaponsOnClientUpdate), GetClientUserId(victimIndex));
     
     // Switch to T
     ToolsSetClientTeam(victimIndex, TEAM_ZOMBIE);
+
+    // Update the presentation of the player
+    ClassOnClientUpdate(victimIndex, true, nemesisMode, respawnMode);
     
     // Terminate the round, if all human was infected
     RoundEndOnValidate();
 
     // Call forward
-    API_OnClientInfected(victimIndex, attackerIndex, nemesisMode, respawnMode);
+    API_OnClientInfected(victimIndex, attackerIndex, nemesisMode, respawnMode, gClassBatch);
 }
 
 /**
@@ -208,6 +232,7 @@ void ClassMakeHuman(const int clientIndex, const bool survivorMode = false, cons
     
     // Resets some tools
     ToolsResetTimers(clientIndex);
+    TasksOnClientClass(clientIndex);
     //ToolsSetClientDetecting(clientIndex, (gCvarList[CVAR_ZOMBIE_XRAY].BoolValue && !respawnMode));
     ToolsSetClientFlashLight(clientIndex, false);
     ToolsSetClientHud(clientIndex, true);
@@ -228,12 +253,9 @@ void ClassMakeHuman(const int clientIndex, const bool survivorMode = false, cons
     }
 
     //*********************************************************************
-    //*       UPDATE MODELS AND SET HUMAN/SURVIVOR CLASS PROPERTIES       *
+    //*              SET HUMAN/SURVIVOR CLASS PROPERTIES                  *
     //*********************************************************************
     
-    // Initialize model char
-    static char sModel[PLATFORM_MAX_PATH]; static char sArm[PLATFORM_MAX_PATH];
-    
     // Sets survivor properties
     if(survivorMode)
     {
@@ -257,10 +279,6 @@ void ClassMakeHuman(const int clientIndex, const bool survivorMode = false, cons
         ToolsSetClientLMV(clientIndex, gCvarList[CVAR_SURVIVOR_SPEED].FloatValue); 
         ToolsSetClientGravity(clientIndex, gCvarList[CVAR_SURVIVOR_GRAVITY].FloatValue);
         ToolsSetClientArmor(clientIndex, 0); 
-        
-        // Gets survivor models
-        //gCvarList[CVAR_SURVIVOR_ARM_MODEL].GetString(sArm, sizeof(sArm)); 
-        gCvarList[CVAR_SURVIVOR_PLAYER_MODEL].GetString(sModel, sizeof(sModel));
     }
     else
     {
@@ -281,9 +299,182 @@ void ClassMakeHuman(const int clientIndex, const bool survivorMode = false, cons
         ToolsSetClientLMV(clientIndex, HumanGetSpeed(gClientData[clientIndex][Client_HumanClass]) + (gCvarList[CVAR_LEVEL_SYSTEM].BoolValue ? (gCvarList[CVAR_LEVEL_SPEED_RATIO].FloatValue * float(gClientData[clientIndex][Client_Level])) : 0.0));
         ToolsSetClientGravity(clientIndex, HumanGetGravity(gClientData[clientIndex][Client_HumanClass]) + (gCvarList[CVAR_LEVEL_SYSTEM].BoolValue ? (gCvarList[CVAR_LEVEL_GRAVITY_RATIO].FloatValue * float(gClientData[clientIndex][Client_Level])) : 0.0));
         ToolsSetClientArmor(clientIndex, (GetClientArmor(clientIndex) < HumanGetArmor(gClientData[clientIndex][Client_HumanClass])) ? HumanGetArmor(gClientData[clientIndex][Client_HumanClass]) : GetClientArmor(clientIndex));
+    }
+
+    // Forward event to modules
+    RequestFrame(view_as<RequestFrameCallback>(WeaponsOnClientUpdate), GetClientUserId(clientIndex));
+    
+    // Validate non-respawn
+    if(!respawnMode) 
+    {
+        // Switch to CT
+        ToolsSetClientTeam(clientIndex, TEAM_HUMAN);
+    }
+
+    // Update the presentation of the player
+    ClassOnClientUpdate(clientIndex, false, survivorMode, respawnMode);
+
+    // Call forward
+    API_OnClientHumanized(clientIndex, survivorMode, respawnMode, gClassBatch);
+}
+
+/**
+ * Update the presentation of the player, or queue it for the batch.
+ *
+ * @param clientIndex       The client index.
+ * @param zombieMode        Indicates that client became a zombie/nemesis.
+ * @param specialMode       Indicates that client became a nemesis/survivor.
+ * @param respawnMode       Indicates that class was set on spawn.
+ **/
+void ClassOnClientUpdate(const int clientIndex, const bool zombieMode, const bool specialMode, const bool respawnMode)
+{
+    // Remove the previous block
+    int iIndex = arrayClassQueue.FindValue(clientIndex, view_as<int>(Class_Client));
+    if(iIndex != -1) arrayClassQueue.Erase(iIndex);
+    
+    // Validate batch
+    if(!gClassBatch || gCvarList[CVAR_GAME_CUSTOM_CLASS_BUDGET].FloatValue <= 0.0)
+    {
+        // Apply presentation now
+        ClassOnClientPresent(clientIndex, zombieMode, specialMode, respawnMode);
+        return;
+    }
+
+    // Initialize the block
+    int iQueue[ClassQueueData];
+    iQueue[Class_Client] = clientIndex;
+    iQueue[Class_UserID] = GetClientUserId(clientIndex);
+    iQueue[Class_Zombie] = zombieMode;
+    iQueue[Class_Special] = specialMode;
+    iQueue[Class_Respawn] = respawnMode;
+
+    // Push the block
+    arrayClassQueue.PushArray(iQueue, sizeof(iQueue));
+
+    // Validate frame
+    if(!gClassQueueFrame)
+    {
+        // Drain on the next frame
+        gClassQueueFrame = true;
+        RequestFrame(view_as<RequestFrameCallback>(ClassOnQueueFrame));
+    }
+}
+
+/**
+ * Frame callback, apply the queued presentation within the time budget.
+ **/
+public void ClassOnQueueFrame(/*void*/)
+{
+    // Clear frame
+    gClassQueueFrame = false;
+
+    // Gets the end of the budget
+    float flEndTime = GetEngineTime() + (gCvarList[CVAR_GAME_CUSTOM_CLASS_BUDGET].FloatValue / 1000.0);
+
+    // Drain at least one block per frame
+    do
+    {
+        // Validate queue
+        if(!arrayClassQueue.Length)
+        {
+            return;
+        }
+
+        // Gets the block
+        int iQueue[ClassQueueData];
+        arrayClassQueue.GetArray(0, iQueue, sizeof(iQueue));
         
+        // Remove the block
+        arrayClassQueue.Erase(0);
+
+        // Validate client
+        int clientIndex = GetClientOfUserId(iQueue[Class_UserID]);
+        if(clientIndex && IsPlayerExist(clientIndex))
+        {
+            // Apply presentation
+            ClassOnClientPresent(clientIndex, iQueue[Class_Zombie], iQueue[Class_Special], iQueue[Class_Respawn]);
+        }
+    }
+    while(GetEngineTime() < flEndTime);
+
+    // Validate queue
+    if(arrayClassQueue.Length)
+    {
+        // Drain on the next frame
+        gClassQueueFrame = true;
+        RequestFrame(view_as<RequestFrameCallback>(ClassOnQueueFrame));
+    }
+}
+
+/**
+ * Apply models, sounds, effects and huds of the current class.
+ *
+ * @param clientIndex       The client index.
+ * @param zombieMode        Indicates that client became a zombie/nemesis.
+ * @param specialMode       Indicates that client became a nemesis/survivor.
+ * @param respawnMode       Indicates that class was set on spawn.
+ **/
+void ClassOnClientPresent(const int clientIndex, const bool zombieMode, const bool specialMode, const bool respawnMode)
+{
+    // Initialize model char
+    static char sModel[PLATFORM_MAX_PATH]; sModel[0] = '\0';
+    
+    // Validate zombie
+    if(zombieMode)
+    {
+        // Validate nemesis
+        if(specialMode)
+        {
+            // Gets nemesis model
+            gCvarList[CVAR_NEMESIS_PLAYER_MODEL].GetString(sModel, sizeof(sModel));
+        }
+        else
+        {
+            // Gets zombie model
+            ZombieGetModel(gClientData[clientIndex][Client_ZombieClass], sModel, sizeof(sModel));
+
+            // If help messages enable, then show 
+            if(gCvarList[CVAR_MESSAGES_HELP].BoolValue)
+            {
+                // Gets zombie info
+                static char sInfo[BIG_LINE_LENGTH];
+                ZombieGetInfo(gClientData[clientIndex][Client_ZombieClass], sInfo, sizeof(sInfo));
+                
+                // Show zombie personal info
+                if(strlen(sInfo)) TranslationPrintHintText(clientIndex, sInfo);
+            }
+            
+            // If instant class menu enable, then show 
+            if(gCvarList[CVAR_ZOMBIE_CLASS_MENU].BoolValue)
+            {
+                // Open the zombie classes menu
+                ZombieMenu(clientIndex, true);
+            }
+        }
+
+        // Apply model
+        if(strlen(sModel)) SetEntityModel(clientIndex, sModel);
+
+        // Forward event to modules
+        SoundsOnClientInfected(clientIndex, respawnMode);
+        VEffectsOnClientInfected(clientIndex, specialMode, respawnMode);
+        LevelSystemOnClientUpdate(clientIndex);
+        if(gCvarList[CVAR_ZOMBIE_NIGHT_VISION]) VOverlayOnClientUpdate(clientIndex, Overlay_Vision);
+        RequestFrame(view_as<RequestFrameCallback>(AccountOnClientUpdate), GetClientUserId(clientIndex));
+        return;
+    }
+    
+    // Validate survivor
+    if(specialMode)
+    {
+        // Gets survivor models
+        //gCvarList[CVAR_SURVIVOR_ARM_MODEL].GetString(sArm, sizeof(sArm)); 
+        gCvarList[CVAR_SURVIVOR_PLAYER_MODEL].GetString(sModel, sizeof(sModel));
+    }
+    else
+    {
         // Gets human models
-        HumanGetArmModel(gClientData[clientIndex][Client_HumanClass], sArm, sizeof(sArm)); HumanGetModel(gClientData[clientIndex][Client_HumanClass], sModel, sizeof(sModel));
+        HumanGetModel(gClientData[clientIndex][Client_HumanClass], sModel, sizeof(sModel));
 
         // If help messages enable, then show 
         if(gCvarList[CVAR_MESSAGES_HELP].BoolValue)
@@ -310,19 +501,8 @@ void ClassMakeHuman(const int clientIndex, const bool survivorMode = false, cons
 
     // Forward event to modules
     SoundsOnClientHumanized(clientIndex);
-    VEffectsOnClientHumanized(clientIndex, survivorMode, respawnMode);
+    VEffectsOnClientHumanized(clientIndex, specialMode, respawnMode);
     VOverlayOnClientUpdate(clientIndex, Overlay_Reset);
     LevelSystemOnClientUpdate(clientIndex);
     RequestFrame(view_as<RequestFrameCallback>(AccountOnClientUpdate), GetClientUserId(clientIndex));
-    RequestFrame(view_as<RequestFrameCallback>(WeaponsOnClientUpdate), GetClientUserId(clientIndex));
-    
-    // Validate non-respawn
-    if(!respawnMode) 
-    {
-        // Switch to CT
-        ToolsSetClientTeam(clientIndex, TEAM_HUMAN);
-    }
-
-    // Call forward
-    API_OnClientHumanized(clientIndex, survivorMode, respawnMode);
 }
\ No newline at end of file
@@ -25,11 +25,44 @@
  * ============================================================================
  **/
  
+/**
+ * Command routes.
+ **/
+enum CommandsRoute
+{
+    Route_Plugin,
+    Route_Menu,
+    Route_Skill,
+    Route_Light
+}
+
+/**
+ * Route data block.
+ **/
+enum CommandsRouteData
+{
+    Route_Bits,                 /** Bits of the core routes, one command can be bound to the few features. */
+    Handle:Route_Forward        /** Callback of the plugin route, or null. */
+}
+
+/**
+ * Gets the bit of the core route.
+ **/
+#define COMMANDS_ROUTE_BIT(%0) (1 << view_as<int>(%0))
+
+/**
+ * Trie to store the routed commands. (command -> [bits, forward])
+ **/
+StringMap trieCommandsRouter;
+ 
 /**
  * Commands are created.
  **/
 void CommandsInit(/*void*/)
 {
+    // Initialize the router
+    trieCommandsRouter = CreateTrie();
+    
     // Forward event to modules
     DebugOnCommandsCreate();
     ConfigOnCommandsCreate();
@@ -39,9 +72,299 @@ void CommandsInit(/*void*/)
     ToolsOnCommandsCreate();
     HumanOnCommandsCreate();
     ZombieOnCommandsCreate();
-    SkillsOnCommandsCreate();
     WeaponsOnCommandsCreate();
     ExtraItemsOnCommandsCreate();
     CostumesOnCommandsCreate();
+    DownloadsOnCommandsCreate();
     VersionOnCommandsCreate();
-}
\ No newline at end of file
+}
+
+/**
+ * Cvars are created.
+ **/
+void CommandsOnCvarInit(/*void*/)
+{
+    // Initialize variable
+    static char sCommand[SMALL_LINE_LENGTH];
+    
+    // Route the bindable commands
+    gCvarList[CVAR_GAME_CUSTOM_MENU_BUTTON].GetString(sCommand, sizeof(sCommand));
+    CommandsRouterAdd(sCommand, Route_Menu, null);
+    gCvarList[CVAR_GAME_CUSTOM_SKILL_BUTTON].GetString(sCommand, sizeof(sCommand));
+    CommandsRouterAdd(sCommand, Route_Skill, null);
+    gCvarList[CVAR_GAME_CUSTOM_LIGHT_BUTTON].GetString(sCommand, sizeof(sCommand));
+    CommandsRouterAdd(sCommand, Route_Light, null);
+    
+    // Hook cvars
+    HookConVarChange(gCvarList[CVAR_GAME_CUSTOM_MENU_BUTTON],  CommandsOnCvarHook);
+    HookConVarChange(gCvarList[CVAR_GAME_CUSTOM_SKILL_BUTTON], CommandsOnCvarHook);
+    HookConVarChange(gCvarList[CVAR_GAME_CUSTOM_LIGHT_BUTTON], CommandsOnCvarHook);
+}
+
+/**
+ * Cvar hook callback. (zp_game_custom_*_button)
+ * Moves the route to the new command.
+ * 
+ * @param hConVar           The cvar handle.
+ * @param oldValue          The value before the attempted change.
+ * @param newValue          The new value.
+ **/
+public void CommandsOnCvarHook(ConVar hConVar, const char[] oldValue, const char[] newValue)
+{
+    // Gets the route of the cvar
+    CommandsRoute iRoute = (hConVar == gCvarList[CVAR_GAME_CUSTOM_MENU_BUTTON]) ? Route_Menu : (hConVar == gCvarList[CVAR_GAME_CUSTOM_SKILL_BUTTON]) ? Route_Skill : Route_Light;
+    
+    // Move the route
+    CommandsRouterRemove(oldValue, iRoute);
+    CommandsRouterAdd(newValue, iRoute, null);
+}
+
+/**
+ * Adds the command to the router.
+ *
+ * @note The core routes replace the plugin routes, the plugin routes replace only routes of unloaded plugins.
+ *       The few core routes can share the same command.
+ *
+ * @param sCommand          The command name.
+ * @param iRoute            The route type.
+ * @param hForward          The callback of the plugin route, or null.
+ * @return                  True if the command was routed, false otherwise.
+ **/
+bool CommandsRouterAdd(const char[] sCommand, const CommandsRoute iRoute, Handle hForward)
+{
+    // Gets the lower case key, the listener receives commands in the lower case
+    static char sKey[SMALL_LINE_LENGTH];
+    if(!CommandsRouterGetKey(sCommand, sKey, sizeof(sKey)))
+    {
+        return false;
+    }
+    
+    // Validate the existing route
+    int iData[CommandsRouteData];
+    if(trieCommandsRouter.GetArray(sKey, iData, sizeof(iData)))
+    {
+        // Validate the plugin route
+        if(iRoute == Route_Plugin ? (iData[Route_Bits] || GetForwardFunctionCount(iData[Route_Forward])) : (iData[Route_Bits] & COMMANDS_ROUTE_BIT(iRoute)) != 0)
+        {
+            LogEvent(false, LogType_Error, LOG_CORE_EVENTS, LogModule_Tools, "Command Router", "Command \"%s\" is already routed", sKey);
+            return false;
+        }
+        
+        // Replace the plugin route
+        delete iData[Route_Forward];
+    }
+    else
+    {
+        // Hook listener
+        AddCommandListener(CommandsOnRouter, sKey);
+    }
+    
+    // Store the route
+    if(iRoute == Route_Plugin)
+    {
+        iData[Route_Forward] = hForward;
+    }
+    else
+    {
+        iData[Route_Bits] |= COMMANDS_ROUTE_BIT(iRoute);
+    }
+    trieCommandsRouter.SetArray(sKey, iData, sizeof(iData));
+    return true;
+}
+
+/**
+ * Removes the command from the router.
+ *
+ * @param sCommand          The command name.
+ * @param iRoute            The route type, which should own the command.
+ * @return                  True if the command was removed, false otherwise.
+ **/
+bool CommandsRouterRemove(const char[] sCommand, const CommandsRoute iRoute)
+{
+    // Gets the lower case key
+    static char sKey[SMALL_LINE_LENGTH];
+    if(!CommandsRouterGetKey(sCommand, sKey, sizeof(sKey)))
+    {
+        return false;
+    }
+    
+    // Validate the owner
+    int iData[CommandsRouteData];
+    if(!trieCommandsRouter.GetArray(sKey, iData, sizeof(iData)) || (iRoute == Route_Plugin ? (iData[Route_Forward] == null) : !(iData[Route_Bits] & COMMANDS_ROUTE_BIT(iRoute))))
+    {
+        return false;
+    }
+    
+    // Remove the route
+    if(iRoute == Route_Plugin)
+    {
+        delete iData[Route_Forward];
+    }
+    else
+    {
+        iData[Route_Bits] &= ~COMMANDS_ROUTE_BIT(iRoute);
+    }
+    
+    // Validate the other routes
+    if(iData[Route_Bits] || iData[Route_Forward] != null)
+    {
+        trieCommandsRouter.SetArray(sKey, iData, sizeof(iData));
+        return true;
+    }
+    
+    // Unhook listener
+    RemoveCommandListener(CommandsOnRouter, sKey);
+    
+    // Remove the command
+    trieCommandsRouter.Remove(sKey);
+    return true;
+}
+
+/**
+ * Gets the router key of the command.
+ *
+ * @param sCommand          The command name.
+ * @param sKey              The key output.
+ * @param iMaxLen           The max length of the key.
+ * @return                  True if the key is valid, false otherwise.
+ **/
+bool CommandsRouterGetKey(const char[] sCommand, char[] sKey, const int iMaxLen)
+{
+    // Copy the command
+    strcopy(sKey, iMaxLen, sCommand);
+    TrimString(sKey);
+    
+    // i = char index
+    int iLen = strlen(sKey);
+    for(int i = 0; i < iLen; i++)
+    {
+        // Convert to the lower case
+        sKey[i] = CharToLower(sKey[i]);
+    }
+    
+    // Return on the success
+    return (iLen > 0);
+}
+
+/**
+ * Callback for command listener of the routed commands.
+ *
+ * @param clientIndex       The client index.
+ * @param commandMsg        Command name, lower case. To get name as typed, use GetCmdArg() and specify argument 0.
+ * @param iArguments        Argument count.
+ **/
+public Action CommandsOnRouter(const int clientIndex, const char[] commandMsg, const int iArguments)
+{
+    // Gets the route
+    int iData[CommandsRouteData];
+    if(!trieCommandsRouter.GetArray(commandMsg, iData, sizeof(iData)))
+    {
+        // Allow command
+        return Plugin_Continue;
+    }
+    
+    // Initialize the result
+    Action resultHandle = Plugin_Continue;
+    
+    // Open the main menu
+    if(iData[Route_Bits] & COMMANDS_ROUTE_BIT(Route_Menu))
+    {
+        resultHandle = CommandsGetResult(resultHandle, MenusOnOpen(clientIndex));
+    }
+    
+    // Use the skill
+    if(iData[Route_Bits] & COMMANDS_ROUTE_BIT(Route_Skill))
+    {
+        resultHandle = CommandsGetResult(resultHandle, SkillsOnUse(clientIndex));
+    }
+    
+    // Switch the flashlight
+    if(iData[Route_Bits] & COMMANDS_ROUTE_BIT(Route_Light))
+    {
+        resultHandle = CommandsGetResult(resultHandle, ToolsOnFlashlight(clientIndex));
+    }
+    
+    // Validate the core routes
+    if(iData[Route_Bits])
+    {
+        return resultHandle;
+    }
+    
+    // Validate the owner plugin, the route is replaced after unload
+    if(!GetForwardFunctionCount(iData[Route_Forward]))
+    {
+        return Plugin_Continue;
+    }
+    
+    // Call the callback
+    Call_StartForward(iData[Route_Forward]);
+    Call_PushCell(clientIndex);
+    Call_PushString(commandMsg);
+    Call_PushCell(iArguments);
+    Call_Finish(resultHandle);
+    return resultHandle;
+}
+
+/**
+ * Gets the stronger result of the two routes.
+ *
+ * @param resultHandle      The current result.
+ * @param routeHandle       The result of the route.
+ * @return                  The stronger result.
+ **/
+Action CommandsGetResult(const Action resultHandle, const Action routeHandle)
+{
+    return (routeHandle > resultHandle) ? routeHandle : resultHandle;
+}
+
+/*
+ * Commands natives API.
+ */
+
+/**
+ * Routes the bindable command to the calling plugin.
+ *
+ * native bool ZP_RegisterCommand(command, callback);
+ **/
+public int API_RegisterCommand(Handle isPlugin, const int iNumParams)
+{
+    // Gets command from native cell
+    static char sCommand[SMALL_LINE_LENGTH];
+    GetNativeString(1, sCommand, sizeof(sCommand));
+    
+    // Create the private callback
+    Handle hForward = CreateForward(ET_Hook, Param_Cell, Param_String, Param_Cell);
+    AddToForward(hForward, isPlugin, GetNativeFunction(2));
+    
+    // Add the route
+    if(!CommandsRouterAdd(sCommand, Route_Plugin, hForward))
+    {
+        delete hForward;
+        return false;
+    }
+    
+    // Return on the success
+    return true;
+}
+
+/**
+ * Releases the bindable command of the calling plugin.
+ *
+ * native bool ZP_UnregisterCommand(command);
+ **/
+public int API_UnregisterCommand(Handle isPlugin, const int iNumParams)
+{
+    // Gets command from native cell
+    static char sCommand[SMALL_LINE_LENGTH]; static char sKey[SMALL_LINE_LENGTH];
+    GetNativeString(1, sCommand, sizeof(sCommand));
+    
+    // Validate the owner plugin
+    int iData[CommandsRouteData];
+    if(!CommandsRouterGetKey(sCommand, sKey, sizeof(sKey)) || !trieCommandsRouter.GetArray(sKey, iData, sizeof(iData)) || iData[Route_Forward] == null || !RemoveAllFromForward(iData[Route_Forward], isPlugin))
+    {
+        return false;
+    }
+    
+    // Remove the route
+    return CommandsRouterRemove(sKey, Route_Plugin);
+}
@@ -25,6 +25,13 @@
  * ============================================================================
  **/
  
+/**
+ * Arrays to store the knockback accumulated by a victim during the current frame.
+ **/
+float gKnockBackVelocity[MAXPLAYERS+1][3];
+bool gKnockBackReplace[MAXPLAYERS+1];
+bool gKnockBackPending[MAXPLAYERS+1];
+ 
 /**
  * Client is joining the server.
  * 
@@ -32,9 +39,12 @@
  **/
 void DamageClientInit(const int clientIndex)
 {
+    // Reset the accumulated knockback
+    DamageOnClientKnockBackReset(clientIndex);
+    
     // Hook damage callbacks
-    SDKHook(clientIndex, SDKHook_TraceAttack,  DamageOnTraceAttack);
-    SDKHook(clientIndex, SDKHook_OnTakeDamage, DamageOnTakeDamage);
+    SDKHook(clientIndex, SDKHook_TraceAttack,  DebugOnTraceAttack);
+    SDKHook(clientIndex, SDKHook_OnTakeDamage, DebugOnTakeDamage);
 }
  
 /**
@@ -53,7 +63,7 @@ void DamageClientInit(const int clientIndex)
 public Action DamageOnTraceAttack(const int victimIndex, int &attackerIndex, int &inflicterIndex, float &damageAmount, int &damageType, int &ammoType, int hitgroupBox, int hitgroupIndex)
 {
     // If gamemodes enable, then check round
-    if(gCvarList[CVAR_GAME_CUSTOM_START].IntValue)
+    if(CVAR_MIRROR(Mirror_GameCustomStart))
     {
         // If mode doesn't started yet, then stop trace
         if(gServerData[Server_RoundNew] || gServerData[Server_RoundEnd])
@@ -79,7 +89,7 @@ public Action DamageOnTraceAttack(const int victimIndex, int &attackerIndex, int
     }
 
     // If damage hitgroups disabled, then allow damage
-    if(!gCvarList[CVAR_GAME_CUSTOM_HITGROUPS].BoolValue)
+    if(!CVAR_MIRROR(Mirror_GameCustomHitgroups))
     {
         // Allow trace
         return Plugin_Continue;
@@ -145,7 +155,7 @@ public Action DamageOnTakeDamage(const int victimIndex, int &attackerIndex, int
     //*********************************************************************
     
     // If gamemodes disabled, then skip
-    if(!gCvarList[CVAR_GAME_CUSTOM_START].IntValue)
+    if(!CVAR_MIRROR(Mirror_GameCustomStart))
     {
         // Allow damage
         return Plugin_Continue;
@@ -198,16 +208,16 @@ public Action DamageOnTakeDamage(const int victimIndex, int &attackerIndex, int
         }
         
         // If level system enabled, then apply multiplier
-        if(gCvarList[CVAR_LEVEL_SYSTEM].BoolValue)
+        if(CVAR_MIRROR(Mirror_LevelSystem))
         {
-            damageAmount *= float(gClientData[attackerIndex][Client_Level]) * gCvarList[CVAR_LEVEL_DAMAGE_RATIO].FloatValue + 1.0;
+            damageAmount *= float(gClientData[attackerIndex][Client_Level]) * CVAR_MIRROR(Mirror_LevelDamageRatio) + 1.0;
         }
 
         // Client was damaged by 'bullet'
         if(damageType & DMG_NEVERGIB)
         {
             // If damage hitgroups enabled, then apply multiplier
-            if(gCvarList[CVAR_GAME_CUSTOM_HITGROUPS].BoolValue)
+            if(CVAR_MIRROR(Mirror_GameCustomHitgroups))
             {
                 // Validate hitgroup index
                 int iHitIndex = HitgroupToIndex(GetEntData(victimIndex, g_iOffset_PlayerHitGroup));
@@ -247,7 +257,7 @@ public Action DamageOnTakeDamage(const int victimIndex, int &attackerIndex, int
         DamageOnClientExp(attackerIndex, damageAmount);
         
         // If help messages enabled, show info
-        if(gCvarList[CVAR_MESSAGES_HELP].BoolValue) TranslationPrintHintText(attackerIndex, "damage info", GetClientHealth(victimIndex));
+        if(CVAR_MIRROR(Mirror_MessagesHelp)) TranslationPrintHintText(attackerIndex, "damage info", GetClientHealth(victimIndex));
     }
     
     // Apply fake damage
@@ -286,6 +296,32 @@ public int API_TakeDamage(Handle isPlugin, const int iNumParams)
     }
 }
 
+/**
+ * Push a client with a knockback, which will be accumulated with other knockbacks of the frame.
+ *
+ * native void ZP_CreateKnockBack(clientIndex, velocity, replace);
+ **/
+public int API_CreateKnockBack(Handle isPlugin, const int iNumParams)
+{
+    // Gets real player index from native cell 
+    int clientIndex = GetNativeCell(1);
+
+    // Validate client
+    if(!IsPlayerExist(clientIndex))
+    {
+        LogEvent(false, LogType_Native, LOG_CORE_EVENTS, LogModule_Tools, "Native Validation", "Invalid the client index (%d)", clientIndex);
+        return -1;
+    }
+    
+    // Gets velocity vector
+    float vVelocity[3];
+    GetNativeArray(2, vVelocity, sizeof(vVelocity));
+    
+    // Accumulate the push
+    DamageOnClientKnockBackAdd(clientIndex, vVelocity, GetNativeCell(3));
+    return 0;
+}
+
 /*
  * Other main functions
  */
@@ -350,14 +386,14 @@ stock Action DamageOnClientFakeDamage(const int clientIndex, const float damageA
 stock Action DamageOnClientInfect(const int victimIndex, const int attackerIndex, const float damageAmount)
 {
     // Last human need to be killed ?
-    if(!gCvarList[CVAR_HUMAN_LAST_INFECTION].BoolValue && fnGetHumans() <= 1)
+    if(!CVAR_MIRROR(Mirror_HumanLastInfection) && fnGetHumans() <= 1)
     {
         // Allow damage
         return Plugin_Changed;
     }
     
     // Human armor need to be reduced before infecting ?
-    if(gCvarList[CVAR_HUMAN_ARMOR_PROTECT].BoolValue)
+    if(CVAR_MIRROR(Mirror_HumanArmorProtect))
     {
         // Gets armor
         int armorAmount = GetClientArmor(victimIndex);
@@ -400,7 +436,7 @@ stock void DamageOnClientKnockBack(const int victimIndex, const int attackerInde
     }
     
     // If nemesis knockback disabled, then stop
-    if(!gCvarList[CVAR_NEMESIS_KNOCKBACK].BoolValue && gClientData[victimIndex][Client_Nemesis])
+    if(!CVAR_MIRROR(Mirror_NemesisKnockBack) && gClientData[victimIndex][Client_Nemesis])
     {
         return;
     }
@@ -430,14 +466,108 @@ stock void DamageOnClientKnockBack(const int victimIndex, const int attackerInde
         // Apply the magnitude by scaling the vector
         ScaleVector(vVelocity, knockbackAmount);
 
-        // Adds the given vector to the client current velocity
-        ToolsClientVelocity(victimIndex, vVelocity);
+        // Adds the given vector to the knockback of the current frame
+        DamageOnClientKnockBackAdd(victimIndex, vVelocity, false);
     }
     
     // Close the trace
     delete hTrace;
 }
 
+/**
+ * Accumulate a knockback, which will be applied once at the next frame.
+ *
+ * @param clientIndex       The client index.
+ * @param vVelocity         The velocity vector.
+ * @param bReplace          If true, the result will replace the client velocity, otherwise it will be added.
+ **/
+void DamageOnClientKnockBackAdd(const int clientIndex, const float vVelocity[3], const bool bReplace)
+{
+    // Switch stacking rule
+    switch(CVAR_MIRROR(Mirror_KnockBackStack))
+    {
+        // Strongest only
+        case 0 :
+        {
+            // Validate a stronger push
+            if(GetVectorLength(vVelocity) > GetVectorLength(gKnockBackVelocity[clientIndex]))
+            {
+                gKnockBackVelocity[clientIndex] = vVelocity;
+                gKnockBackReplace[clientIndex] = bReplace;
+            }
+        }
+        
+        // Sum all
+        case 1 :
+        {
+            AddVectors(gKnockBackVelocity[clientIndex], vVelocity, gKnockBackVelocity[clientIndex]);
+            gKnockBackReplace[clientIndex] |= bReplace;
+        }
+        
+        // Last only
+        default :
+        {
+            gKnockBackVelocity[clientIndex] = vVelocity;
+            gKnockBackReplace[clientIndex] = bReplace;
+        }
+    }
+
+    // Validate the first push in the frame
+    if(!gKnockBackPending[clientIndex])
+    {
+        // Apply all pushes on the next frame
+        gKnockBackPending[clientIndex] = true;
+        RequestFrame(view_as<RequestFrameCallback>(DamageOnClientKnockBackPost), clientIndex);
+    }
+}
+
+/**
+ * Apply the accumulated knockback after the frame.
+ *
+ * @param clientIndex       The client index.
+ **/
+public void DamageOnClientKnockBackPost(const int clientIndex)
+{
+    // Validate client
+    if(gKnockBackPending[clientIndex] && IsPlayerExist(clientIndex))
+    {
+        // Validate maximum speed
+        float flMax = CVAR_MIRROR(Mirror_KnockBackMax);
+        if(flMax)
+        {
+            // Gets the length of the push
+            float flLength = GetVectorLength(gKnockBackVelocity[clientIndex]);
+            
+            // Scale the vector to the limit
+            if(flLength > flMax)
+            {
+                ScaleVector(gKnockBackVelocity[clientIndex], flMax / flLength);
+            }
+        }
+
+        // Push the client with a single velocity update
+        ToolsClientVelocity(clientIndex, gKnockBackVelocity[clientIndex], true, !gKnockBackReplace[clientIndex]);
+    }
+    
+    // Reset the accumulated knockback
+    DamageOnClientKnockBackReset(clientIndex);
+}
+
+/**
+ * Reset the accumulated knockback.
+ *
+ * @param clientIndex       The client index.
+ **/
+void DamageOnClientKnockBackReset(const int clientIndex)
+{
+    // Clear the push
+    gKnockBackVelocity[clientIndex][0] = 0.0;
+    gKnockBackVelocity[clientIndex][1] = 0.0;
+    gKnockBackVelocity[clientIndex][2] = 0.0;
+    gKnockBackReplace[clientIndex] = false;
+    gKnockBackPending[clientIndex] = false;
+}
+
 /**
  * Reward ammopacks for applied damage.
  *
@@ -453,7 +583,7 @@ stock void DamageOnClientAmmo(const int clientIndex, const float damageAmount)
     nAppliedDamage[clientIndex] += RoundFloat(damageAmount);
     
     // Counting bonuses
-    int nBonus = gClientData[clientIndex][Client_Zombie] ? gCvarList[CVAR_BONUS_DAMAGE_ZOMBIE].IntValue : gClientData[clientIndex][Client_Survivor] ? gCvarList[CVAR_BONUS_DAMAGE_SURVIVOR].IntValue : gCvarList[CVAR_BONUS_DAMAGE_HUMAN].IntValue;
+    int nBonus = gClientData[clientIndex][Client_Zombie] ? CVAR_MIRROR(Mirror_BonusDamageZombie) : gClientData[clientIndex][Client_Survivor] ? CVAR_MIRROR(Mirror_BonusDamageSurvivor) : CVAR_MIRROR(Mirror_BonusDamageHuman);
 
     // Validate bonus
     if(!nBonus)
@@ -486,7 +616,7 @@ stock void DamageOnClientAmmo(const int clientIndex, const float damageAmount)
 stock void DamageOnClientExp(const int clientIndex, const float damageAmount)
 {
     // If level system disabled, then stop
-    if(!gCvarList[CVAR_LEVEL_SYSTEM].BoolValue)
+    if(!CVAR_MIRROR(Mirror_LevelSystem))
     {
         return;
     }
@@ -498,7 +628,7 @@ stock void DamageOnClientExp(const int clientIndex, const float damageAmount)
     nAppliedDamage[clientIndex] += RoundFloat(damageAmount);
     
     // Counting bonuses
-    int nBonus = gClientData[clientIndex][Client_Zombie] ? gCvarList[CVAR_LEVEL_DAMAGE_ZOMBIE].IntValue : gClientData[clientIndex][Client_Survivor] ? gCvarList[CVAR_LEVEL_DAMAGE_SURVIVOR].IntValue : gCvarList[CVAR_LEVEL_DAMAGE_HUMAN].IntValue;
+    int nBonus = gClientData[clientIndex][Client_Zombie] ? CVAR_MIRROR(Mirror_LevelDamageZombie) : gClientData[clientIndex][Client_Survivor] ? CVAR_MIRROR(Mirror_LevelDamageSurvivor) : CVAR_MIRROR(Mirror_LevelDamageHuman);
 
     // Validate bonus
     if(!nBonus)
@@ -25,6 +25,56 @@
  * ============================================================================
  **/
  
+/**
+ * Respawn queue data block.
+ **/
+enum DeathQueueData
+{
+    Queue_Client,
+    Queue_UserID,
+    Float:Queue_Time
+}
+
+/**
+ * Array to store the queued respawns, sorted by the due time.
+ **/
+ArrayList arrayDeathQueue;
+
+/**
+ * Timer of the queue head and the pending frame of the queue drain.
+ **/
+Handle hDeathQueueTimer = INVALID_HANDLE;
+bool gDeathQueueFrame;
+
+/**
+ * Indicates that the queue is paused by a game mode.
+ **/
+bool gDeathQueuePaused;
+
+/**
+ * Initialize the respawn queue.
+ **/
+void DeathInit(/*void*/)
+{
+    // Initialize the array of blocks
+    arrayDeathQueue = CreateArray(view_as<int>(DeathQueueData));
+}
+
+/**
+ * Purge the respawn queue on the map end.
+ **/
+void DeathPurge(/*void*/)
+{
+    // Clear the list
+    arrayDeathQueue.Clear();
+
+    // Purge the timer
+    hDeathQueueTimer = INVALID_HANDLE; /// with flag TIMER_FLAG_NO_MAPCHANGE
+    
+    // Resume the queue
+    gDeathQueuePaused = false;
+}
+
 /**
  * Client has been killed.
  * 
@@ -48,6 +98,12 @@ void DeathOnClientDeath(const int victimIndex, const int attackerIndex)
         // Player was killed by other ?
         if(victimIndex != attackerIndex) 
         {
+            // Verify that the attacker is exist
+            bool bAttacker = IsPlayerExist(attackerIndex);
+            
+            // Increment kills of the stats
+            if(bAttacker) gClientData[attackerIndex][Client_Kills]++;
+            
             // If respawn amount more, than limit, stop
             if(gClientData[victimIndex][Client_RespawnTimes] > gCvarList[CVAR_RESPAWN_AMOUNT].IntValue)
             {
@@ -55,7 +111,7 @@ void DeathOnClientDeath(const int victimIndex, const int attackerIndex)
             }
             
             // Verify that the attacker is exist
-            if(IsPlayerExist(attackerIndex))
+            if(bAttacker)
             {
                 // Increment exp and bonuses
                 if(gClientData[victimIndex][Client_Zombie])
@@ -85,49 +141,337 @@ void DeathOnClientDeath(const int victimIndex, const int attackerIndex)
         // Increment count
         gClientData[victimIndex][Client_RespawnTimes]++;
         
-        // Sets timer for respawn player
-        delete gClientData[victimIndex][Client_RespawnTimer];
-        gClientData[victimIndex][Client_RespawnTimer] = CreateTimer(gCvarList[CVAR_RESPAWN_TIME].FloatValue, DeathOnRespawn, GetClientUserId(victimIndex), TIMER_FLAG_NO_MAPCHANGE);
+        // Queue the respawn of player
+        DeathQueueAdd(victimIndex, gCvarList[CVAR_RESPAWN_TIME].FloatValue);
     }
 }
 
 /**
- * Timer callback, respawn a player.
+ * Queue the respawn of a player.
  *
- * @param hTimer            The timer handle.
- * @param userID            The user id.
+ * @param clientIndex       The client index.
+ * @param flDelay           The delay in seconds.
  **/
-public Action DeathOnRespawn(Handle hTimer, const int userID)
+void DeathQueueAdd(const int clientIndex, float flDelay)
 {
-    // Gets the client index from the user ID
-    int clientIndex = GetClientOfUserId(userID);
+    // Call forward
+    Action resultHandle = API_OnClientRespawnQueued(clientIndex, flDelay);
 
-    // Clear timer
-    gClientData[clientIndex][Client_RespawnTimer] = INVALID_HANDLE;    
+    // Validate handle
+    if(resultHandle == Plugin_Handled || resultHandle == Plugin_Stop)
+    {
+        return;
+    }
+
+    // Gets the due time
+    float flTime = GetGameTime() + flDelay;
+
+    // Validate the wave interval
+    float flWave = gCvarList[CVAR_RESPAWN_WAVE].FloatValue;
+    if(flWave > 0.0)
+    {
+        // Round up to the next wave
+        flTime = float(RoundToCeil(flTime / flWave)) * flWave;
+    }
+
+    // Push the block
+    DeathQueueInsert(clientIndex, flTime);
+}
+
+/**
+ * Remove the queued respawn of a player.
+ *
+ * @param clientIndex       The client index.
+ * @return                  True if the player was queued, false otherwise.
+ **/
+bool DeathQueueRemove(const int clientIndex)
+{
+    // Gets the array index
+    int iIndex = arrayDeathQueue.FindValue(clientIndex, view_as<int>(Queue_Client));
+
+    // Validate block
+    if(iIndex == -1)
+    {
+        return false;
+    }
+
+    // Remove the block
+    arrayDeathQueue.Erase(iIndex);
+    return true;
+}
+
+/**
+ * Insert the block into the queue, keeping the order by the due time.
+ *
+ * @param clientIndex       The client index.
+ * @param flTime            The due game time.
+ **/
+void DeathQueueInsert(const int clientIndex, const float flTime)
+{
+    // Remove the previous block
+    DeathQueueRemove(clientIndex);
     
-    // Validate client
-    if(clientIndex)
+    // Initialize the block
+    int iQueue[DeathQueueData];
+    iQueue[Queue_Client] = clientIndex;
+    iQueue[Queue_UserID] = GetClientUserId(clientIndex);
+    iQueue[Queue_Time] = flTime;
+
+    // i = block index
+    int iSize = arrayDeathQueue.Length;
+    for(int i = 0; i < iSize; i++)
     {
-        // If mode doesn't started yet, then stop
-        if(gServerData[Server_RoundNew] || gServerData[Server_RoundEnd])
+        // Find the first later block
+        if(view_as<float>(arrayDeathQueue.Get(i, view_as<int>(Queue_Time))) > flTime)
         {
-            return Plugin_Stop;
+            // Insert the block
+            arrayDeathQueue.ShiftUp(i);
+            arrayDeathQueue.SetArray(i, iQueue, sizeof(iQueue));
+            
+            // Update the schedule
+            DeathQueueSchedule();
+            return;
         }
+    }
+
+    // Push the block
+    arrayDeathQueue.PushArray(iQueue, sizeof(iQueue));
+    
+    // Update the schedule
+    DeathQueueSchedule();
+}
+
+/**
+ * Schedule the drain of the queue by the due time of the head.
+ **/
+void DeathQueueSchedule(/*void*/)
+{
+    // Validate queue
+    if(gDeathQueuePaused || gDeathQueueFrame || !arrayDeathQueue.Length)
+    {
+        return;
+    }
+    
+    // Gets the delay of the head
+    float flDelay = view_as<float>(arrayDeathQueue.Get(0, view_as<int>(Queue_Time))) - GetGameTime();
+
+    // Validate delay, the head is already due
+    if(flDelay <= 0.0)
+    {
+        // Drain on the next frame
+        delete hDeathQueueTimer;
+        gDeathQueueFrame = true;
+        RequestFrame(view_as<RequestFrameCallback>(DeathOnQueueFrame));
+        return;
+    }
+
+    // Sets timer for the head, the one-shot timer also covers the delay below its resolution of 0.1 second
+    delete hDeathQueueTimer;
+    hDeathQueueTimer = CreateTimer(flDelay, DeathOnQueueTimer, _, TIMER_FLAG_NO_MAPCHANGE);
+}
+
+/**
+ * Timer callback, the head of the queue is due.
+ *
+ * @param hTimer            The timer handle.
+ **/
+public Action DeathOnQueueTimer(Handle hTimer)
+{
+    // Clear timer
+    hDeathQueueTimer = INVALID_HANDLE;
+
+    // Update the schedule
+    DeathQueueSchedule();
+    
+    // Destroy timer
+    return Plugin_Stop;
+}
+
+/**
+ * Frame callback, respawn the due players within the budget.
+ **/
+public void DeathOnQueueFrame(/*void*/)
+{
+    // Clear frame
+    gDeathQueueFrame = false;
 
-        // Respawn player automatically, if allowed on the current game mode
-        if(ModesIsRespawn(gServerData[Server_RoundMode]))
+    // Validate pause
+    if(gDeathQueuePaused)
+    {
+        return;
+    }
+    
+    // Gets the budget and the current time
+    int iBudget = gCvarList[CVAR_RESPAWN_BUDGET].IntValue;
+    float flTime = GetGameTime();
+
+    // i = respawn amount
+    for(int i = 0; arrayDeathQueue.Length && (!iBudget || i < iBudget); i++)
+    {
+        // Validate the due time
+        if(view_as<float>(arrayDeathQueue.Get(0, view_as<int>(Queue_Time))) > flTime)
         {
-            // Respawn if only the last human/zombie is left? (ignore this setting on survivor/nemesis rounds)
-            if((!ModesIsSurvivor(gServerData[Server_RoundMode]) && !gCvarList[CVAR_RESPAWN_LAST].BoolValue && fnGetHumans() <= 1) || (!ModesIsNemesis(gServerData[Server_RoundMode]) && !gCvarList[CVAR_RESPAWN_LAST].BoolValue && fnGetZombies() <= 1))
-            {
-                return Plugin_Stop;
-            }
+            break;
+        }
 
+        // Gets the client index from the user ID
+        int clientIndex = GetClientOfUserId(arrayDeathQueue.Get(0, view_as<int>(Queue_UserID)));
+        
+        // Remove the block
+        arrayDeathQueue.Erase(0);
+        
+        // Validate client
+        if(clientIndex)
+        {
             // Respawn a player
-            ToolsForceToRespawn(clientIndex);
+            DeathOnRespawn(clientIndex);
         }
     }
     
-    // Destroy timer
-    return Plugin_Stop;
-}
\ No newline at end of file
+    // Update the schedule
+    DeathQueueSchedule();
+}
+
+/**
+ * Respawn a player from the queue.
+ *
+ * @param clientIndex       The client index.
+ **/
+void DeathOnRespawn(const int clientIndex)
+{
+    // If mode doesn't started yet, then stop
+    if(gServerData[Server_RoundNew] || gServerData[Server_RoundEnd])
+    {
+        return;
+    }
+
+    // Respawn player automatically, if allowed on the current game mode
+    if(ModesIsRespawn(gServerData[Server_RoundMode]))
+    {
+        // Respawn if only the last human/zombie is left? (ignore this setting on survivor/nemesis rounds)
+        if((!ModesIsSurvivor(gServerData[Server_RoundMode]) && !gCvarList[CVAR_RESPAWN_LAST].BoolValue && fnGetHumans() <= 1) || (!ModesIsNemesis(gServerData[Server_RoundMode]) && !gCvarList[CVAR_RESPAWN_LAST].BoolValue && fnGetZombies() <= 1))
+        {
+            return;
+        }
+
+        // Call forward
+        Action resultHandle = API_OnClientRespawn(clientIndex);
+        
+        // Validate handle
+        if(resultHandle == Plugin_Handled)
+        {
+            // Defer the respawn
+            DeathQueueInsert(clientIndex, GetGameTime() + gCvarList[CVAR_RESPAWN_TIME].FloatValue);
+            return;
+        }
+        else if(resultHandle == Plugin_Stop)
+        {
+            return;
+        }
+        
+        // Respawn a player
+        ToolsForceToRespawn(clientIndex);
+    }
+}
+
+/*
+ * Respawn queue natives API.
+ */
+
+/**
+ * Pauses or resumes the respawn queue.
+ *
+ * native void ZP_PauseRespawnQueue(pause);
+ **/
+public int API_PauseRespawnQueue(Handle isPlugin, const int iNumParams)
+{
+    // Sets the pause
+    gDeathQueuePaused = view_as<bool>(GetNativeCell(1));
+
+    // Validate pause
+    if(gDeathQueuePaused)
+    {
+        // Stop the head timer
+        delete hDeathQueueTimer;
+    }
+    else
+    {
+        // Update the schedule
+        DeathQueueSchedule();
+    }
+}
+
+/**
+ * Makes all queued respawns due, keeping the order.
+ *
+ * native int ZP_FlushRespawnQueue();
+ **/
+public int API_FlushRespawnQueue(Handle isPlugin, const int iNumParams)
+{
+    // Gets the current time
+    float flTime = GetGameTime();
+
+    // i = block index
+    int iSize = arrayDeathQueue.Length;
+    for(int i = 0; i < iSize; i++)
+    {
+        // Sets the due time
+        arrayDeathQueue.Set(i, flTime, view_as<int>(Queue_Time));
+    }
+    
+    // Update the schedule
+    DeathQueueSchedule();
+
+    // Return the amount
+    return iSize;
+}
+
+/**
+ * Sets the delay of the queued respawn, or queues a dead player.
+ *
+ * native void ZP_SetClientRespawnTime(clientIndex, delay);
+ **/
+public int API_SetClientRespawnTime(Handle isPlugin, const int iNumParams)
+{
+    // Gets real player index from native cell 
+    int clientIndex = GetNativeCell(1);
+
+    // Validate client
+    if(!IsPlayerExist(clientIndex, false))
+    {
+        LogEvent(false, LogType_Native, LOG_CORE_EVENTS, LogModule_Tools, "Native Validation", "Invalid the client index (%d)", clientIndex);
+        return -1;
+    }
+    
+    // Validate death
+    if(IsPlayerAlive(clientIndex))
+    {
+        LogEvent(false, LogType_Native, LOG_CORE_EVENTS, LogModule_Tools, "Native Validation", "The client is alive (%d)", clientIndex);
+        return -1;
+    }
+    
+    // Queue the respawn of player, with the forward and the wave interval
+    DeathQueueAdd(clientIndex, view_as<float>(GetNativeCell(2)));
+    return 0;
+}
+
+/**
+ * Gets the remaining delay of the queued respawn.
+ *
+ * native float ZP_GetClientRespawnTime(clientIndex);
+ **/
+public int API_GetClientRespawnTime(Handle isPlugin, const int iNumParams)
+{
+    // Gets the array index
+    int iIndex = arrayDeathQueue.FindValue(GetNativeCell(1), view_as<int>(Queue_Client));
+
+    // Validate block
+    if(iIndex == -1)
+    {
+        return view_as<int>(-1.0);
+    }
+
+    // Return the value
+    float flDelay = view_as<float>(arrayDeathQueue.Get(iIndex, view_as<int>(Queue_Time))) - GetGameTime();
+    return view_as<int>(flDelay > 0.0 ? flDelay : 0.0);
+}
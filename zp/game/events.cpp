@@ -25,11 +25,51 @@
  * ============================================================================
  **/
 
+/**
+ * @section Weapon event hooks.
+ **/
+#define EVENT_HOOK_FIRE          (1 << 0)    /** weapon_fire */
+#define EVENT_HOOK_BULLET        (1 << 1)    /** bullet_impact */
+#define EVENT_HOOK_SHOOT         (1 << 2)    /** Shotgun Shot */
+/**
+ * @endsection
+ **/
+
+/**
+ * Killfeed entry data block.
+ **/
+enum EventFeedData
+{
+    Feed_Victim,
+    Feed_Attacker
+}
+
+/**
+ * Array to store the queued killfeed entries.
+ **/
+ArrayList arrayEventFeed;
+
+/**
+ * Recipients of the killfeed. (Real players in the game)
+ **/
+int gEventFeedClients[MAXPLAYERS+1];
+int gEventFeedCount;
+bool gEventFeedUpdate = true;
+bool gEventFeedPending;
+
+/**
+ * Weapon events which are hooked now.
+ **/
+int gEventWeaponHooks;
+
 /**
  * Hook events used by plugin.
  **/
 void EventInit(/*void*/)
 {
+    // Initialize the killfeed queue
+    arrayEventFeed = CreateArray(view_as<int>(EventFeedData));
+
     // Hook server events
     //HookEvent("round_prestart",      EventRoundPreStart,    EventHookMode_Pre);
     HookEvent("round_start",         EventRoundStart,       EventHookMode_Post);
@@ -40,12 +80,45 @@ void EventInit(/*void*/)
     HookEvent("player_spawn",        EventPlayerSpawn,      EventHookMode_Post);
     HookEvent("player_death",        EventPlayerDeath,      EventHookMode_Pre);
     HookEvent("player_jump",         EventPlayerJump,       EventHookMode_Post);
-    HookEvent("weapon_fire",         EventPlayerFire,       EventHookMode_Pre);
-    HookEvent("bullet_impact",       EventPlayerBullet,     EventHookMode_Post);
     HookEvent("hostage_follows",     EventPlayerHostage,    EventHookMode_Post);
+    
+    // Weapon events are hooked only while any player holds a weapon, which needs them
+    // (weapon_fire, bullet_impact, Shotgun Shot) See EventHookWeapons()
+}
 
-    // Hook temp events
-    AddTempEntHook("Shotgun Shot",   EventPlayerShoot);
+/**
+ * Hook the weapon events, which are needed by the held weapons, and unhook others.
+ *
+ * @param iHooks            The weapon event flags.
+ **/
+void EventHookWeapons(const int iHooks)
+{
+    // Gets the changed events
+    int iChanged = iHooks ^ gEventWeaponHooks;
+    
+    // Validate fire event
+    if(iChanged & EVENT_HOOK_FIRE)
+    {
+        if(iHooks & EVENT_HOOK_FIRE) HookEvent("weapon_fire", EventPlayerFire, EventHookMode_Pre);
+        else UnhookEvent("weapon_fire", EventPlayerFire, EventHookMode_Pre);
+    }
+    
+    // Validate bullet event
+    if(iChanged & EVENT_HOOK_BULLET)
+    {
+        if(iHooks & EVENT_HOOK_BULLET) HookEvent("bullet_impact", EventPlayerBullet, EventHookMode_Post);
+        else UnhookEvent("bullet_impact", EventPlayerBullet, EventHookMode_Post);
+    }
+    
+    // Validate shoot temp event
+    if(iChanged & EVENT_HOOK_SHOOT)
+    {
+        if(iHooks & EVENT_HOOK_SHOOT) AddTempEntHook("Shotgun Shot", EventPlayerShoot);
+        else RemoveTempEntHook("Shotgun Shot", EventPlayerShoot);
+    }
+    
+    // Store the hooked events
+    gEventWeaponHooks = iHooks;
 }
 
 /*
@@ -76,8 +149,14 @@ public void OnClientDisconnect_Post(int clientIndex)
     
     // Forward event to modules
     DataBaseOnClientDisconnect(clientIndex);
+    TasksOnClientDisconnect(clientIndex);
+    SoundsOnClientDisconnect(clientIndex);
+    WeaponsOnClientDisconnect(clientIndex);
     ToolsOnClientDisconnect(clientIndex);
     RoundEndOnClientDisconnect();
+
+    // Update the killfeed recipients
+    gEventFeedUpdate = true;
 }
 
 /**
@@ -97,6 +176,9 @@ public void OnClientPostAdminCheck(int clientIndex)
     AntiStickClientInit(clientIndex);
     DataBaseClientInit(clientIndex);
     CostumesClientInit(clientIndex);
+
+    // Update the killfeed recipients
+    gEventFeedUpdate = true;
 }
 
 /*
@@ -204,6 +286,7 @@ public Action EventPlayerDeath(Event hEvent, const char[] sName, bool dontBroadc
     SoundsOnClientDeath(victimIndex);
     VEffectOnClientDeath(victimIndex);
     WeaponsOnClientDeath(victimIndex);
+    TasksOnClientDeath(victimIndex);
     DeathOnClientDeath(victimIndex, attackerIndex);
     
     // Allow death
@@ -219,26 +302,107 @@ public Action EventPlayerDeath(Event hEvent, const char[] sName, bool dontBroadc
  **/
 public void EventFakePlayerDeath(const int victimIndex, const int attackerIndex)
 {
+    // Gets the user ids
+    int victimID = GetClientUserId(victimIndex);
+    int attackerID = GetClientUserId(attackerIndex);
+
+    // Coalesce entries of the same victim
+    int iIndex = arrayEventFeed.FindValue(victimID, view_as<int>(Feed_Victim));
+    if(iIndex != -1)
+    {
+        // Update the attacker
+        arrayEventFeed.Set(iIndex, attackerID, view_as<int>(Feed_Attacker));
+    }
+    else
+    {
+        // Initialize the block
+        int iFeed[EventFeedData];
+        iFeed[Feed_Victim] = victimID;
+        iFeed[Feed_Attacker] = attackerID;
+
+        // Push the block
+        arrayEventFeed.PushArray(iFeed, sizeof(iFeed));
+    }
+
+    // Sends the queue on the next frame
+    if(!gEventFeedPending)
+    {
+        gEventFeedPending = true;
+        RequestFrame(view_as<RequestFrameCallback>(EventOnFeedFlush));
+    }
+}
+
+/**
+ * Sends the queued killfeed entries.
+ **/
+public void EventOnFeedFlush(/*void*/)
+{
+    // Reset the request
+    gEventFeedPending = false;
+
+    // Validate the recipients
+    if(gEventFeedUpdate)
+    {
+        // i = client index
+        gEventFeedCount = 0;
+        for(int i = 1; i <= MaxClients; i++)
+        {
+            // Store the real player
+            if(IsPlayerExist(i, false) && !IsFakeClient(i)) gEventFeedClients[gEventFeedCount++] = i;
+        }
+
+        // Recipients is updated
+        gEventFeedUpdate = false;
+    }
+
+    // Gets the amount of the entries for sending
+    int iSize = arrayEventFeed.Length;
+    int iMax = CVAR_MIRROR(Mirror_GameCustomKillfeed);
+    if(iMax && iSize > iMax) iSize = iMax;
+    
     // Create and send custom death icon
     Event hEvent = CreateEvent("player_death");
     if(hEvent != INVALID_HANDLE)
     {
-        // Sets event properties
-        hEvent.SetInt("userid", GetClientUserId(victimIndex));
-        hEvent.SetInt("attacker", GetClientUserId(attackerIndex));
+        // Sets constant properties
         hEvent.SetString("weapon", "weapon_claws");
         hEvent.SetBool("headshot", true);
-        
-        // i = client index
-        for(int i = 1; i <= MaxClients; i++)
+
+        // i = entry index
+        for(int i = 0; i < iSize; i++)
         {
-            // Send fake event
-            if(IsPlayerExist(i, false) && !IsFakeClient(i)) hEvent.FireToClient(i);
+            // Sets event properties
+            hEvent.SetInt("userid", arrayEventFeed.Get(i, view_as<int>(Feed_Victim)));
+            hEvent.SetInt("attacker", arrayEventFeed.Get(i, view_as<int>(Feed_Attacker)));
+
+            // x = recipient index
+            for(int x = 0; x < gEventFeedCount; x++)
+            {
+                // Send fake event
+                hEvent.FireToClient(gEventFeedClients[x]);
+            }
         }
         
         // Close it
         hEvent.Close();
     }
+
+    // Remove the sent entries
+    if(iSize == arrayEventFeed.Length)
+    {
+        arrayEventFeed.Clear();
+        return;
+    }
+
+    // i = entry index
+    for(int i = 0; i < iSize; i++)
+    {
+        arrayEventFeed.Erase(0);
+    }
+
+    // Sends others on the next frame
+    gEventFeedPending = true;
+    RequestFrame(view_as<RequestFrameCallback>(EventOnFeedFlush));
 }
 
 /**
@@ -271,6 +435,12 @@ public Action EventPlayerFire(Event hEvent, const char[] sName, bool dontBroadca
     // Gets all required event info
     int clientIndex = GetClientOfUserId(hEvent.GetInt("userid"));
 
+    // Validate weapon hook
+    if(!(gClientData[clientIndex][Client_WeaponHooks] & EVENT_HOOK_FIRE))
+    {
+        return;
+    }
+
     // Validate client
     if(!IsPlayerExist(clientIndex))
     {
@@ -303,6 +473,12 @@ public Action EventPlayerBullet(Event hEvent, const char[] sName, bool dontBroad
     // Gets all required event info
     int clientIndex = GetClientOfUserId(hEvent.GetInt("userid"));
 
+    // Validate weapon hook
+    if(!(gClientData[clientIndex][Client_WeaponHooks] & EVENT_HOOK_BULLET))
+    {
+        return;
+    }
+
     // Validate client
     if(!IsPlayerExist(clientIndex))
     {
@@ -386,6 +562,12 @@ public Action EventPlayerShoot(const char[] sTEName, const int[] iPlayers, int n
     // Gets all required event info
     int clientIndex = TE_ReadNum("m_iPlayer") + 1;
 
+    // Validate weapon hook
+    if(!(gClientData[clientIndex][Client_WeaponHooks] & EVENT_HOOK_SHOOT))
+    {
+        return Plugin_Continue;
+    }
+
     // Validate client
     if(!IsPlayerExist(clientIndex))
     {
@@ -33,7 +33,7 @@
 void JumpBoostOnClientJump(const int clientIndex)
 { 
     // If jump boost disabled, then stop
-    if(!gCvarList[CVAR_JUMPBOOST_ENABLE].BoolValue)
+    if(!CVAR_MIRROR(Mirror_JumpBoostEnable))
     {
         return;
     }
@@ -62,15 +62,15 @@ public void JumpBoostOnClientJumpPost(const int userID)
         ToolsGetClientVelocity(clientIndex, vVelocity);
         
         // Only apply horizontal multiplier if it not a bhop
-        if(SquareRoot(Pow(vVelocity[0], 2.0) + Pow(vVelocity[1], 2.0)) < gCvarList[CVAR_JUMPBOOST_MAX].FloatValue)
+        if(SquareRoot(Pow(vVelocity[0], 2.0) + Pow(vVelocity[1], 2.0)) < CVAR_MIRROR(Mirror_JumpBoostMax))
         {
             // Apply horizontal multipliers to jump vector
-            vVelocity[0] *= gCvarList[CVAR_JUMPBOOST_MULTIPLIER].FloatValue;
-            vVelocity[1] *= gCvarList[CVAR_JUMPBOOST_MULTIPLIER].FloatValue;
+            vVelocity[0] *= CVAR_MIRROR(Mirror_JumpBoostMultiplier);
+            vVelocity[1] *= CVAR_MIRROR(Mirror_JumpBoostMultiplier);
         }
 
         // Apply height multiplier to jump vector
-        vVelocity[2] *= gCvarList[CVAR_JUMPBOOST_MULTIPLIER].FloatValue;
+        vVelocity[2] *= CVAR_MIRROR(Mirror_JumpBoostMultiplier);
 
         // Set new velocity
         ToolsClientVelocity(clientIndex, vVelocity, true, false);
@@ -104,20 +104,20 @@ void JumpBoostOnClientLeapJump(const int clientIndex)
         if(gClientData[clientIndex][Client_Nemesis])
         {
             // If nemesis leap disabled, then stop
-            if(!gCvarList[CVAR_LEAP_NEMESIS].BoolValue) 
+            if(!CVAR_MIRROR(Mirror_LeapNemesis)) 
             {
                 return;
             }
             
             // Gets countdown time
-            flCountDown = gCvarList[CVAR_LEAP_NEMESIS_COUNTDOWN].FloatValue;
+            flCountDown = CVAR_MIRROR(Mirror_LeapNemesisCountDown);
         }
         
         // If not
         else
         {
             // Switch type of leap jump
-            switch(gCvarList[CVAR_LEAP_ZOMBIE].IntValue)
+            switch(CVAR_MIRROR(Mirror_LeapZombie))
             {
                 // If zombie leap disabled, then stop
                 case 0 :
@@ -135,7 +135,7 @@ void JumpBoostOnClientLeapJump(const int clientIndex)
             }
             
             // Gets countdown time
-            flCountDown = gCvarList[CVAR_LEAP_ZOMBIE_COUNTDOWN].FloatValue;
+            flCountDown = CVAR_MIRROR(Mirror_LeapZombieCountDown);
         }
     }
     
@@ -146,13 +146,13 @@ void JumpBoostOnClientLeapJump(const int clientIndex)
         if(gClientData[clientIndex][Client_Survivor])
         {
             // If survivor leap disabled, then stop
-            if(!gCvarList[CVAR_LEAP_SURVIVOR].BoolValue)
+            if(!CVAR_MIRROR(Mirror_LeapSurvivor))
             {
                 return;
             }
             
             // Gets countdown time
-            flCountDown = gCvarList[CVAR_LEAP_SURVIVOR_COUNTDOWN].FloatValue;
+            flCountDown = CVAR_MIRROR(Mirror_LeapSurvivorCountDown);
         }
         
         // If player is human, stop
@@ -197,7 +197,7 @@ void JumpBoostOnClientLeapJump(const int clientIndex)
     GetAngleVectors(vAngle, vVelocity, NULL_VECTOR, NULL_VECTOR);
     
     // Scale vector for the boost
-    ScaleVector(vVelocity, gClientData[clientIndex][Client_Survivor] ? gCvarList[CVAR_LEAP_SURVIVOR_FORCE].FloatValue : (gClientData[clientIndex][Client_Nemesis] ? gCvarList[CVAR_LEAP_NEMESIS_FORCE].FloatValue : gCvarList[CVAR_LEAP_ZOMBIE_FORCE].FloatValue));
+    ScaleVector(vVelocity, gClientData[clientIndex][Client_Survivor] ? CVAR_MIRROR(Mirror_LeapSurvivorForce) : (gClientData[clientIndex][Client_Nemesis] ? CVAR_MIRROR(Mirror_LeapNemesisForce) : CVAR_MIRROR(Mirror_LeapZombieForce)));
     
     // Restore eye angle
     vAngle[0] = flAngleZero;
@@ -41,6 +41,18 @@
  * @param iMouse            Mouse direction (x, y).
  **/ 
 public Action OnPlayerRunCmd(int clientIndex, int &iButtons, int &iImpulse, float flVelocity[3], float flAngles[3], int &weaponID, int &iSubType, int &iCmdNum, int &iTickCount, int &iSeed, int iMouse[2])
+{
+    // Profile the hook
+    DEBUG_PROFILE_START(Profile_RunCmd);
+    Action resultHandle = RunCmdOnPlayerRunCmd(clientIndex, iButtons, iImpulse, flVelocity, flAngles, weaponID, iSubType, iCmdNum, iTickCount, iSeed, iMouse);
+    DEBUG_PROFILE_STOP(Profile_RunCmd);
+    return resultHandle;
+}
+
+/**
+ * Process the player command.
+ **/
+Action RunCmdOnPlayerRunCmd(int clientIndex, int &iButtons, int &iImpulse, float flVelocity[3], float flAngles[3], int &weaponID, int &iSubType, int &iCmdNum, int &iTickCount, int &iSeed, int iMouse[2])
 {
     // Initialize variable
     static int iLastButtons[MAXPLAYERS+1];
@@ -53,7 +65,7 @@ public Action OnPlayerRunCmd(int clientIndex, int &iButtons, int &iImpulse, floa
         {
             //!! IMPORTANT BUG FIX !!//
             // Ladder can reset gravity, so update it each frame
-            ToolsSetClientGravity(clientIndex, gClientData[clientIndex][Client_Nemesis] ? gCvarList[CVAR_NEMESIS_GRAVITY].FloatValue : (gClientData[clientIndex][Client_Zombie] ? ZombieGetGravity(gClientData[clientIndex][Client_ZombieClass]) : HumanGetGravity(gClientData[clientIndex][Client_HumanClass])));
+            ToolsSetClientGravity(clientIndex, gClientData[clientIndex][Client_Nemesis] ? CVAR_MIRROR(Mirror_NemesisGravity) : (gClientData[clientIndex][Client_Zombie] ? ZombieGetGravity(gClientData[clientIndex][Client_ZombieClass]) : HumanGetGravity(gClientData[clientIndex][Client_HumanClass])));
 
             // Update client position on the radar
             ToolsSetClientSpot(clientIndex, !gClientData[clientIndex][Client_Zombie]);
@@ -25,15 +25,6 @@
  * ============================================================================
  **/
 
-/**
- * Creates commands for skills module. Called when commands are created.
- **/
-void SkillsOnCommandsCreate(/*void*/)
-{
-    // Hook listeners
-    AddCommandListener(SkillsOnUse);
-}
-
 /**
  * Client has been infected.
  * 
@@ -117,34 +108,24 @@ public Action SkillsOnHealthRegen(Handle hTimer, const int userID)
 }
 
 /**
- * Callback for command listener to use skill for human/zombie.
+ * Called when the skill button is pressed. Routed by the command router.
  *
  * @param clientIndex       The client index.
- * @param commandMsg        Command name, lower case. To get name as typed, use GetCmdArg() and specify argument 0.
- * @param iArguments        Argument count.
  **/
-public Action SkillsOnUse(const int clientIndex, const char[] commandMsg, const int iArguments)
+Action SkillsOnUse(const int clientIndex)
 {
     // Validate client 
     if(IsPlayerExist(clientIndex))
     {
-        // Gets command alias
-        static char sCommand[SMALL_LINE_LENGTH];
-        gCvarList[CVAR_GAME_CUSTOM_SKILL_BUTTON].GetString(sCommand, sizeof(sCommand));
-        
-        // Validate command
-        if(!strcmp(sCommand, commandMsg))
+        // Validate human/zombie
+        if(gClientData[clientIndex][Client_Nemesis] || gClientData[clientIndex][Client_Survivor])
         {
-            // Validate human/zombie
-            if(gClientData[clientIndex][Client_Nemesis] || gClientData[clientIndex][Client_Survivor])
-            {
-                return Plugin_Handled;
-            }
-            
-            // Do the skill
-            SkillsOnStart(clientIndex);
             return Plugin_Handled;
         }
+        
+        // Do the skill
+        SkillsOnStart(clientIndex);
+        return Plugin_Handled;
     }
     
     // Allow command
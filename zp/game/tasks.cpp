@@ -0,0 +1,363 @@
+/**
+ * ============================================================================
+ *
+ *  Zombie Plague Mod #3 Generation
+ *
+ *  File:          tasks.cpp
+ *  Type:          Game
+ *  Description:   Client timers of the sub-plugins, bound to the client lifetime.
+ *
+ *  Copyright (C) 2015-2018 Nikita Ushakov (Ireland, Dublin)
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * ============================================================================
+ **/
+
+/**
+ * @section Task flags.
+ **/
+#define TASK_FLAG_REPEAT         (1 << 0)    /** Repeat the task until the callback returns Plugin_Stop. */
+#define TASK_FLAG_DEATH          (1 << 1)    /** Kill the task when the client dies. */
+#define TASK_FLAG_CLASS          (1 << 2)    /** Kill the task when the client becomes a zombie or a human. */
+#define TASK_FLAG_WEAPON         (1 << 3)    /** Kill the task when the client switches from the current weapon. */
+/**
+ * @endsection
+ **/
+
+/**
+ * Task data block.
+ **/
+enum TaskData
+{
+    Task_ID,
+    Task_Client,
+    Task_UserID,
+    Task_Flags,
+    Task_Weapon,
+    Task_Data,
+    Handle:Task_Timer,
+    Handle:Task_Forward,
+    Handle:Task_Plugin
+}
+
+/**
+ * Array to store the active tasks.
+ **/
+ArrayList arrayTasks;
+
+/**
+ * Last issued task id.
+ **/
+int gTaskCounter;
+
+/**
+ * Initialize the task list.
+ **/
+void TasksInit(/*void*/)
+{
+    // Initialize the array of blocks
+    arrayTasks = CreateArray(view_as<int>(TaskData));
+}
+
+/**
+ * Purge the task list on the map end.
+ **/
+void TasksPurge(/*void*/)
+{
+    // i = task index
+    int iSize = arrayTasks.Length;
+    for(int i = 0; i < iSize; i++)
+    {
+        // Delete the callback
+        Handle hForward = arrayTasks.Get(i, view_as<int>(Task_Forward));
+        delete hForward; /// Timers are killed with flag TIMER_FLAG_NO_MAPCHANGE
+    }
+
+    // Clear the list
+    arrayTasks.Clear();
+}
+
+/**
+ * Kill tasks of the client by flags.
+ *
+ * @param clientIndex       The client index.
+ * @param iFlags            The task flags to match, or 0 to kill all client tasks.
+ * @param weaponIndex       (Optional) The weapon index, which keeps the weapon tasks alive.
+ **/
+void TasksOnClientKill(const int clientIndex, const int iFlags, const int weaponIndex = INVALID_ENT_REFERENCE)
+{
+    // i = task index
+    for(int i = arrayTasks.Length - 1; i >= 0; i--)
+    {
+        // Validate client
+        if(arrayTasks.Get(i, view_as<int>(Task_Client)) != clientIndex)
+        {
+            continue;
+        }
+
+        // Validate flags
+        int iTaskFlags = arrayTasks.Get(i, view_as<int>(Task_Flags));
+        if(iFlags && !(iTaskFlags & iFlags))
+        {
+            continue;
+        }
+
+        // Validate the current weapon
+        if((iFlags & TASK_FLAG_WEAPON) && weaponIndex != INVALID_ENT_REFERENCE && EntRefToEntIndex(arrayTasks.Get(i, view_as<int>(Task_Weapon))) == weaponIndex)
+        {
+            continue;
+        }
+
+        // Kill the task
+        TasksKill(i, true);
+    }
+}
+
+/**
+ * Client has been disconnected.
+ *
+ * @param clientIndex       The client index.
+ **/
+void TasksOnClientDisconnect(const int clientIndex)
+{
+    // Kill all tasks
+    TasksOnClientKill(clientIndex, 0);
+}
+
+/**
+ * Client has been killed.
+ *
+ * @param clientIndex       The client index.
+ **/
+void TasksOnClientDeath(const int clientIndex)
+{
+    // Kill the death tasks
+    TasksOnClientKill(clientIndex, TASK_FLAG_DEATH);
+}
+
+/**
+ * Client has been changed class.
+ *
+ * @param clientIndex       The client index.
+ **/
+void TasksOnClientClass(const int clientIndex)
+{
+    // Kill the class tasks
+    TasksOnClientKill(clientIndex, TASK_FLAG_CLASS);
+}
+
+/**
+ * Client has been switched weapon.
+ *
+ * @param clientIndex       The client index.
+ * @param weaponIndex       The weapon index.
+ **/
+void TasksOnClientDeploy(const int clientIndex, const int weaponIndex)
+{
+    // Kill the weapon tasks of other weapons
+    TasksOnClientKill(clientIndex, TASK_FLAG_WEAPON, weaponIndex);
+}
+
+/**
+ * Kill the task.
+ *
+ * @param iIndex            The array index.
+ * @param bTimer            If true, the timer will be killed too.
+ **/
+void TasksKill(const int iIndex, const bool bTimer)
+{
+    // Delete the callback
+    Handle hForward = arrayTasks.Get(iIndex, view_as<int>(Task_Forward));
+    delete hForward;
+
+    // Validate timer
+    if(bTimer)
+    {
+        // Delete the timer
+        Handle hTimer = arrayTasks.Get(iIndex, view_as<int>(Task_Timer));
+        delete hTimer;
+    }
+
+    // Remove the block
+    arrayTasks.Erase(iIndex);
+}
+
+/**
+ * Timer for the task callback.
+ *
+ * @param hTimer            The timer handle.
+ * @param taskID            The task id.
+ **/
+public Action TasksOnTimer(Handle hTimer, const int taskID)
+{
+    // Gets the array index
+    int iIndex = arrayTasks.FindValue(taskID, view_as<int>(Task_ID));
+
+    // Validate task
+    if(iIndex == -1)
+    {
+        // Destroy timer
+        return Plugin_Stop;
+    }
+
+    // Gets the task data
+    int clientIndex = arrayTasks.Get(iIndex, view_as<int>(Task_Client));
+    int iFlags = arrayTasks.Get(iIndex, view_as<int>(Task_Flags));
+    Handle hForward = arrayTasks.Get(iIndex, view_as<int>(Task_Forward));
+
+    // Validate client and the owner plugin
+    Action resultHandle = Plugin_Stop;
+    if(GetClientOfUserId(arrayTasks.Get(iIndex, view_as<int>(Task_UserID))) == clientIndex && GetForwardFunctionCount(hForward))
+    {
+        // Call the callback
+        Call_StartForward(hForward);
+        Call_PushCell(clientIndex);
+        Call_PushCell(arrayTasks.Get(iIndex, view_as<int>(Task_Data)));
+        Call_Finish(resultHandle);
+    }
+
+    // Gets the array index, the callback could kill tasks
+    iIndex = arrayTasks.FindValue(taskID, view_as<int>(Task_ID));
+    if(iIndex == -1)
+    {
+        // Destroy timer
+        return Plugin_Stop;
+    }
+    
+    // Validate repeat
+    if(!(iFlags & TASK_FLAG_REPEAT) || resultHandle == Plugin_Stop)
+    {
+        // Remove the task, timer is destroyed by the return
+        TasksKill(iIndex, false);
+        return Plugin_Stop;
+    }
+
+    // Allow timer
+    return Plugin_Continue;
+}
+
+/*
+ * Tasks natives API.
+ */
+
+/**
+ * Creates a task bound to the client lifetime.
+ *
+ * native int ZP_CreateClientTask(clientIndex, interval, callback, data, flags);
+ **/
+public int API_CreateClientTask(Handle isPlugin, const int iNumParams)
+{
+    // Gets real player index from native cell
+    int clientIndex = GetNativeCell(1);
+
+    // Validate client
+    if(!IsPlayerExist(clientIndex, false))
+    {
+        LogEvent(false, LogType_Native, LOG_CORE_EVENTS, LogModule_Tools, "Native Validation", "Invalid the client index (%d)", clientIndex);
+        return -1;
+    }
+
+    // Gets the interval
+    float flInterval = GetNativeCell(2);
+
+    // Validate interval
+    if(flInterval <= 0.0)
+    {
+        LogEvent(false, LogType_Native, LOG_CORE_EVENTS, LogModule_Tools, "Native Validation", "Invalid the task interval (%f)", flInterval);
+        return -1;
+    }
+
+    // Gets the flags
+    int iFlags = GetNativeCell(5);
+
+    // Create the private callback, it is released on the owner unload
+    Handle hForward = CreateForward(ET_Hook, Param_Cell, Param_Cell);
+    AddToForward(hForward, isPlugin, GetNativeFunction(3));
+
+    // Initialize the block
+    int iTask[TaskData];
+    iTask[Task_ID] = ++gTaskCounter;
+    iTask[Task_Client] = clientIndex;
+    iTask[Task_UserID] = GetClientUserId(clientIndex);
+    iTask[Task_Flags] = iFlags;
+    iTask[Task_Weapon] = (iFlags & TASK_FLAG_WEAPON) ? EntIndexToEntRef(GetEntDataEnt2(clientIndex, g_iOffset_PlayerActiveWeapon)) : INVALID_ENT_REFERENCE;
+    iTask[Task_Data] = GetNativeCell(4);
+    iTask[Task_Timer] = CreateTimer(flInterval, TasksOnTimer, iTask[Task_ID], (iFlags & TASK_FLAG_REPEAT) ? (TIMER_REPEAT | TIMER_FLAG_NO_MAPCHANGE) : TIMER_FLAG_NO_MAPCHANGE);
+    iTask[Task_Forward] = hForward;
+    iTask[Task_Plugin] = isPlugin;
+
+    // Push the block
+    arrayTasks.PushArray(iTask, sizeof(iTask));
+
+    // Return the task id
+    return iTask[Task_ID];
+}
+
+/**
+ * Kills a task of the client created by the calling plugin.
+ *
+ * native bool ZP_KillClientTask(taskID);
+ **/
+public int API_KillClientTask(Handle isPlugin, const int iNumParams)
+{
+    // Gets the array index
+    int iIndex = arrayTasks.FindValue(GetNativeCell(1), view_as<int>(Task_ID));
+
+    // Validate task
+    if(iIndex == -1)
+    {
+        return false;
+    }
+
+    // Validate the owner plugin
+    if(arrayTasks.Get(iIndex, view_as<int>(Task_Plugin)) != isPlugin)
+    {
+        LogEvent(false, LogType_Native, LOG_CORE_EVENTS, LogModule_Tools, "Native Validation", "Invalid the task owner (%d)", GetNativeCell(1));
+        return false;
+    }
+
+    // Kill the task
+    TasksKill(iIndex, true);
+    return true;
+}
+
+/**
+ * Kills all tasks of the client created by the calling plugin.
+ *
+ * native void ZP_KillClientTasks(clientIndex);
+ **/
+public int API_KillClientTasks(Handle isPlugin, const int iNumParams)
+{
+    // Gets real player index from native cell
+    int clientIndex = GetNativeCell(1);
+
+    // i = task index
+    for(int i = arrayTasks.Length - 1; i >= 0; i--)
+    {
+        // Validate client
+        if(arrayTasks.Get(i, view_as<int>(Task_Client)) != clientIndex)
+        {
+            continue;
+        }
+
+        // Validate the owner plugin
+        Handle hForward = arrayTasks.Get(i, view_as<int>(Task_Forward));
+        if(RemoveAllFromForward(hForward, isPlugin))
+        {
+            // Kill the task
+            TasksKill(i, true);
+        }
+    }
+}
@@ -36,6 +36,26 @@ Handle hSDKCallLookupAttachment;
 Handle hSDKCallGetAttachment_Linux;
 Handle hSDKCallGetAttachment_Windows;
 
+/**
+ * Max length of the message block list.
+ **/
+#define TOOLS_MESSAGES_LENGTH 1024
+
+/**
+ * Trie to store the blocked engine messages and their counters. (key -> count)
+ **/
+StringMap trieToolsMessages;
+
+/**
+ * Block list in the old concatenated format, matched by substring. (empty if the list uses exact keys)
+ **/
+char sToolsMessagesLegacy[TOOLS_MESSAGES_LENGTH];
+
+/**
+ * Trie to store the resolved attachments. ("model path:name" -> index, "model path#index" -> name)
+ **/
+StringMap trieToolsAttachments;
+
 // Tools Functions (core)
 #include "zp/game/tools_functions.cpp"
 
@@ -49,6 +69,9 @@ void ToolsInit(/*void*/)
 
     // Setup SDKTools
     ToolsSetupGameData();
+    
+    // Initialize the trie of attachments
+    trieToolsAttachments = CreateTrie();
 }
 
 /**
@@ -62,6 +85,9 @@ void ToolsPurge(/*void*/)
         // Purge player timers
         ToolsPurgeTimers(i); /// with flag TIMER_FLAG_NO_MAPCHANGE
     }
+    
+    // Clear the resolved attachments, models can be changed on the next map
+    trieToolsAttachments.Clear();
 }
 
 /**
@@ -233,7 +259,7 @@ public int API_UpdateTransmitState(Handle isPlugin, const int iNumParams)
 /**
  * Validate the attachment on the entity.
  *
- * native bool ZP_LookupAttachment(entityIndex, attach);
+ * native int ZP_LookupAttachment(entityIndex, attach);
  **/
 public int API_LookupAttachment(Handle isPlugin, const int iNumParams)
 {
@@ -303,6 +329,43 @@ public int API_GetAttachment(Handle isPlugin, const int iNumParams)
     // Extract data
     ToolsGetAttachment(entityIndex, sAttach, vOrigin, vAngle);
     
+    // Return on the success
+    SetNativeArray(3, vOrigin, sizeof(vOrigin)); return SetNativeArray(4, vAngle, sizeof(vAngle));
+}
+
+/**
+ * Gets the attachment of the entity by the resolved index.
+ *
+ * native void ZP_GetAttachmentByIndex(entityIndex, attach, origin, angles);
+ **/
+public int API_GetAttachmentByIndex(Handle isPlugin, const int iNumParams)
+{
+    // Gets entity index from native cell 
+    int entityIndex = GetNativeCell(1);
+    
+    // Validate entity
+    if(!IsValidEdict(entityIndex))
+    {
+        LogEvent(false, LogType_Native, LOG_CORE_EVENTS, LogModule_Tools, "Native Validation", "Invalid the entity index (%d)", entityIndex);
+        return -1;
+    }
+    
+    // Gets attachment index from native cell 
+    int iAttach = GetNativeCell(2);
+    
+    // Validate attachment
+    if(iAttach <= 0)
+    {
+        LogEvent(false, LogType_Native, LOG_CORE_EVENTS, LogModule_Tools, "Native Validation", "Invalid the attachment index (%d)", iAttach);
+        return -1;
+    }
+    
+    // Initialize variables
+    static float vOrigin[3]; static float vAngle[3];
+    
+    // Extract data
+    ToolsGetAttachmentByIndex(entityIndex, iAttach, vOrigin, vAngle);
+    
     // Return on the success
     SetNativeArray(3, vOrigin, sizeof(vOrigin)); return SetNativeArray(4, vAngle, sizeof(vAngle));
 }
\ No newline at end of file
@@ -72,7 +72,9 @@
     AddCommandListener(ToolsOnGeneric, "explode");
     AddCommandListener(ToolsOnGeneric, "killvector");
     AddCommandListener(ToolsOnGeneric, "jointeam");
-    AddCommandListener(ToolsOnFlashlight);
+    
+    // Hook commands
+    RegAdminCmd("zp_messages_stats", ToolsMessageStats, ADMFLAG_GENERIC, "Prints the counters of the blocked engine messages. Usage: zp_messages_stats [reset]");
     
     // Hook messages
     HookUserMessage(GetUserMessageId("TextMsg"), ToolsMessage, true);
@@ -136,9 +138,8 @@ public Action ToolsOnGeneric(const int clientIndex, const char[] commandMsg, con
                                     }
                                     else
                                     {   
-                                        // Sets timer for respawn player
-                                        delete gClientData[clientIndex][Client_RespawnTimer];
-                                        gClientData[clientIndex][Client_RespawnTimer] = CreateTimer(gCvarList[CVAR_RESPAWN_TIME].FloatValue, DeathOnRespawn, GetClientUserId(clientIndex), TIMER_FLAG_NO_MAPCHANGE);
+                                        // Queue the respawn of player
+                                        DeathQueueAdd(clientIndex, gCvarList[CVAR_RESPAWN_TIME].FloatValue);
                                     }
 
                                     // Fix first connection time
@@ -207,43 +208,33 @@ public Action ToolsOnGeneric(const int clientIndex, const char[] commandMsg, con
 }
 
 /**
- * Callback for command listener to on/off flashlight.
+ * Called when the flashlight button is pressed. Routed by the command router.
  *
  * @param clientIndex       The client index.
- * @param commandMsg        Command name, lower case. To get name as typed, use GetCmdArg() and specify argument 0.
- * @param iArguments        Argument count.
  **/
-public Action ToolsOnFlashlight(const int clientIndex, const char[] commandMsg, const int iArguments)
+Action ToolsOnFlashlight(const int clientIndex)
 {
     // Validate client 
     if(IsPlayerExist(clientIndex))
     {
-        // Gets command alias 
-        static char sCommand[SMALL_LINE_LENGTH];
-        gCvarList[CVAR_GAME_CUSTOM_LIGHT_BUTTON].GetString(sCommand, sizeof(sCommand));
-        
-        // Validate command
-        if(!strcmp(sCommand, commandMsg))
+        // If zombie nightvision ?
+        if(gClientData[clientIndex][Client_Zombie])
         {
-            // If zombie nightvision ?
-            if(gClientData[clientIndex][Client_Zombie])
-            {
-                // Switch on/off nightvision
-                if(gCvarList[CVAR_ZOMBIE_NIGHT_VISION] && !gServerData[Server_RoundEnd]) VOverlayOnClientUpdate(clientIndex, !ToolsGetClientNightVision(clientIndex, true) ? Overlay_Vision : Overlay_Reset);
-            }
-            // If human flashlight ?
-            else
-            {
-                // Switch on/off flashlight
-                ToolsSetClientFlashLight(clientIndex, true);
-                
-                // Forward event to modules
-                SoundsOnClientFlashLight(clientIndex);
-            }
+            // Switch on/off nightvision
+            if(gCvarList[CVAR_ZOMBIE_NIGHT_VISION] && !gServerData[Server_RoundEnd]) VOverlayOnClientUpdate(clientIndex, !ToolsGetClientNightVision(clientIndex, true) ? Overlay_Vision : Overlay_Reset);
+        }
+        // If human flashlight ?
+        else
+        {
+            // Switch on/off flashlight
+            ToolsSetClientFlashLight(clientIndex, true);
             
-            // Block command
-            return Plugin_Handled;
+            // Forward event to modules
+            SoundsOnClientFlashLight(clientIndex);
         }
+        
+        // Block command
+        return Plugin_Handled;
     }
     
     // Allow command
@@ -263,15 +254,156 @@ public Action ToolsOnFlashlight(const int clientIndex, const char[] commandMsg,
 public Action ToolsMessage(UserMsg iMessage, BfRead hBuffer, const int[] iPlayers, const int playersNum, const bool bReliable, const bool bInit)
 {
     // Initialize engine message
-    static char sTxtMsg[PLATFORM_MAX_PATH]; 
+    static char sTxtMsg[PLATFORM_MAX_PATH]; int iCount;
     PbReadString(hBuffer, "params", sTxtMsg, sizeof(sTxtMsg), 0); 
 
-    // Initialize block message list
-    static char sBlockMsg[PLATFORM_MAX_PATH];
-    gCvarList[CVAR_MESSAGES_BLOCK].GetString(sBlockMsg, sizeof(sBlockMsg)); 
+    // Gets the message key without the localization prefix
+    int iShift = (sTxtMsg[0] == '#') ? 1 : 0;
+    
+    // Validate the blocked message
+    if(!trieToolsMessages.GetValue(sTxtMsg[iShift], iCount))
+    {
+        // Validate the old concatenated list
+        if(!strlen(sToolsMessagesLegacy) || StrContains(sToolsMessagesLegacy, sTxtMsg[iShift]) == -1)
+        {
+            // Allow message
+            return Plugin_Continue;
+        }
+    }
+    
+    // Update the counter
+    trieToolsMessages.SetValue(sTxtMsg[iShift], iCount + 1);
+    
+    // Block message
+    return Plugin_Handled;
+}
+
+/**
+ * Cvars are created.
+ **/
+void ToolsOnCvarInit(/*void*/)
+{
+    // Initialize the trie of messages
+    trieToolsMessages = CreateTrie();
+    
+    // Parse the block list
+    static char sBlockMsg[TOOLS_MESSAGES_LENGTH];
+    gCvarList[CVAR_MESSAGES_BLOCK].GetString(sBlockMsg, sizeof(sBlockMsg));
+    ToolsMessageOnParse(sBlockMsg);
+    
+    // Hook cvars
+    HookConVarChange(gCvarList[CVAR_MESSAGES_BLOCK], ToolsMessageOnCvarHook);
+}
+
+/**
+ * Cvar hook callback. (zp_messages_block)
+ * Parses the new block list.
+ * 
+ * @param hConVar           The cvar handle.
+ * @param oldValue          The value before the attempted change.
+ * @param newValue          The new value.
+ **/
+public void ToolsMessageOnCvarHook(ConVar hConVar, const char[] oldValue, const char[] newValue)
+{
+    // Parse the block list
+    ToolsMessageOnParse(newValue);
+}
+
+/**
+ * Parses the block list into the trie of message keys.
+ *
+ * @param sList             The list of message keys, separated by spaces or commas.
+ *                          A list without separators is the old format and is matched by substring.
+ **/
+void ToolsMessageOnParse(const char[] sList)
+{
+    // Clear the keys and the counters
+    trieToolsMessages.Clear();
+    
+    // Initialize variables
+    static char sBuffer[TOOLS_MESSAGES_LENGTH]; static char sKey[NORMAL_LINE_LENGTH];
+    strcopy(sBuffer, sizeof(sBuffer), sList);
+    TrimString(sBuffer);
+    
+    // Validate the old concatenated format (one token without separators)
+    sToolsMessagesLegacy[0] = '\0';
+    if(strlen(sBuffer) && FindCharInString(sBuffer, ',') == -1 && FindCharInString(sBuffer, ' ') == -1)
+    {
+        // Keep the substring matching of the old format
+        strcopy(sToolsMessagesLegacy, sizeof(sToolsMessagesLegacy), sBuffer[(sBuffer[0] == '#') ? 1 : 0]);
+        LogEvent(false, LogType_Error, LOG_CORE_EVENTS, LogModule_Tools, "Config Validation", "Cvar \"zp_messages_block\" has no separators and is matched by substring as the old format. Use a comma separated list of exact keys (a single key needs a trailing comma)");
+        return;
+    }
+    
+    // Replace separators with spaces
+    ReplaceString(sBuffer, sizeof(sBuffer), ",", " ");
+    
+    // Read the keys
+    int iIndex; int iNext;
+    do
+    {
+        // Gets the next key
+        iNext = BreakString(sBuffer[iIndex], sKey, sizeof(sKey));
+        
+        // Store the key without the localization prefix
+        if(strlen(sKey))
+        {
+            trieToolsMessages.SetValue(sKey[(sKey[0] == '#') ? 1 : 0], 0);
+        }
+        
+        // Shift to the next key
+        iIndex += iNext;
+    }
+    while(iNext != -1);
+}
 
-    // Block messages on the matching
-    return (StrContains(sBlockMsg, sTxtMsg) != -1) ? Plugin_Handled : Plugin_Continue; 
+/**
+ * Handles the <!zp_messages_stats> command. Prints the counters of the blocked messages.
+ * 
+ * @param clientIndex       The client index.
+ * @param iArguments        The number of arguments that were in the argument string.
+ **/
+public Action ToolsMessageStats(const int clientIndex, const int iArguments)
+{
+    // Initialize variables
+    static char sKey[NORMAL_LINE_LENGTH]; int iCount;
+    
+    // Validate reset
+    bool bReset;
+    if(iArguments)
+    {
+        GetCmdArg(1, sKey, sizeof(sKey));
+        bReset = !strcmp(sKey, "reset", false);
+    }
+    
+    // Gets the message keys
+    StringMapSnapshot hSnapshot = trieToolsMessages.Snapshot();
+    
+    // Print the header
+    ReplyToCommand(clientIndex, "%-48s %s", "Message", "Blocked");
+    ReplyToCommand(clientIndex, "--------------------------------------------------------------------------------");
+    
+    // i = key index
+    int iSize = hSnapshot.Length;
+    for(int i = 0; i < iSize; i++)
+    {
+        // Gets the counter
+        hSnapshot.GetKey(i, sKey, sizeof(sKey));
+        trieToolsMessages.GetValue(sKey, iCount);
+        
+        // Resets the counter
+        if(bReset)
+        {
+            trieToolsMessages.SetValue(sKey, 0);
+        }
+        
+        // Print the counter
+        ReplyToCommand(clientIndex, "%-48s %d", sKey, iCount);
+    }
+    
+    // Close snapshot
+    delete hSnapshot;
+    return Plugin_Handled;
 }
 
 /**
@@ -302,6 +434,9 @@ void ToolsResetVars(const int clientIndex)
     gClientData[clientIndex][Client_DataID] = -1;
     gClientData[clientIndex][Client_Costume] = -1;
     gClientData[clientIndex][Client_Time] = 0;
+    gClientData[clientIndex][Client_Kills] = 0;
+    gClientData[clientIndex][Client_Infections] = 0;
+    gClientData[clientIndex][Client_Rank] = 0;
     gClientData[clientIndex][Client_AttachmentCostume] = INVALID_ENT_REFERENCE;
     gClientData[clientIndex][Client_AttachmentBits] = 0;
     gClientData[clientIndex][Client_AttachmentAddons] = { INVALID_ENT_REFERENCE, INVALID_ENT_REFERENCE, INVALID_ENT_REFERENCE, INVALID_ENT_REFERENCE, INVALID_ENT_REFERENCE, INVALID_ENT_REFERENCE, INVALID_ENT_REFERENCE, INVALID_ENT_REFERENCE, INVALID_ENT_REFERENCE, INVALID_ENT_REFERENCE, INVALID_ENT_REFERENCE };
@@ -310,6 +445,7 @@ void ToolsResetVars(const int clientIndex)
     gClientData[clientIndex][Client_CustomWeapon] = 0;
     gClientData[clientIndex][Client_DrawSequence] = -1;
     gClientData[clientIndex][Client_WeaponIndex] = -1;
+    gClientData[clientIndex][Client_WeaponHooks] = 0;
     gClientData[clientIndex][Client_ToggleSequence] = false;
     gClientData[clientIndex][Client_LastSequenceParity] = -1;
     gClientData[clientIndex][Client_SwapWeapon] = INVALID_ENT_REFERENCE;
@@ -365,11 +501,13 @@ void ToolsResetTimers(const int clientIndex)
 {
     delete gClientData[clientIndex][Client_LevelTimer];
     delete gClientData[clientIndex][Client_AccountTimer];
-    delete gClientData[clientIndex][Client_RespawnTimer];
     delete gClientData[clientIndex][Client_SkillTimer];
     delete gClientData[clientIndex][Client_CountDownTimer];
     delete gClientData[clientIndex][Client_HealTimer];
     delete gClientData[clientIndex][Client_MoanTimer]; 
+    
+    // Remove the queued respawn
+    DeathQueueRemove(clientIndex);
 }
 
 /**
@@ -381,7 +519,6 @@ void ToolsPurgeTimers(const int clientIndex)
 {
     gClientData[clientIndex][Client_LevelTimer] = INVALID_HANDLE;
     gClientData[clientIndex][Client_AccountTimer] = INVALID_HANDLE;
-    gClientData[clientIndex][Client_RespawnTimer] = INVALID_HANDLE;
     gClientData[clientIndex][Client_SkillTimer] = INVALID_HANDLE;
     gClientData[clientIndex][Client_CountDownTimer] = INVALID_HANDLE;
     gClientData[clientIndex][Client_HealTimer] = INVALID_HANDLE;    
@@ -715,15 +852,36 @@ stock void ToolsUpdateTransmitState(const int entityIndex)
 }
 
 /**
- * Validate the attachment on the entity.
+ * Gets the attachment index on the entity. Indexes are cached per model path.
  *
  * @param clientIndex       The entity index.
  * @param sAttach           The attachment name.
- * @return                  True or false.
+ * @return                  The attachment index, or 0 if it doesn't exist.
  **/
-bool ToolsLookupAttachment(const int entityIndex, const char[] sAttach)
+int ToolsLookupAttachment(const int entityIndex, const char[] sAttach)
 {
-    return SDKCall(hSDKCallLookupAttachment, entityIndex, sAttach);
+    // Gets the cache key
+    static char sModel[PLATFORM_MAX_PATH]; static char sKey[PLATFORM_MAX_PATH]; int iAttach;
+    GetEntPropString(entityIndex, Prop_Data, "m_ModelName", sModel, sizeof(sModel));
+    FormatEx(sKey, sizeof(sKey), "%s:%s", sModel, sAttach);
+    
+    // Validate cache
+    if(!trieToolsAttachments.GetValue(sKey, iAttach))
+    {
+        // Resolve the attachment
+        iAttach = SDKCall(hSDKCallLookupAttachment, entityIndex, sAttach);
+        trieToolsAttachments.SetValue(sKey, iAttach);
+        
+        // Store the name for the index based calls on windows
+        if(iAttach)
+        {
+            FormatEx(sKey, sizeof(sKey), "%s#%d", sModel, iAttach);
+            trieToolsAttachments.SetString(sKey, sAttach);
+        }
+    }
+    
+    // Return the index
+    return iAttach;
 }
 
 /**
@@ -743,10 +901,38 @@ void ToolsGetAttachment(const int entityIndex, const char[] sAttach, float vOrig
     }
     else
     {
-        int iAnimating = SDKCall(hSDKCallLookupAttachment, entityIndex, sAttach);
-        if(iAnimating)
+        int iAttach = ToolsLookupAttachment(entityIndex, sAttach);
+        if(iAttach)
+        {
+            SDKCall(hSDKCallGetAttachment_Linux, entityIndex, iAttach, vOrigin, vAngle); 
+        }
+    }
+}
+
+/**
+ * Gets the attachment of the entity by the resolved index.
+ *
+ * @param clientIndex       The entity index.
+ * @param iAttach           The attachment index.
+ * @param vOrigin           The origin ouput.
+ * @param vAngle            The angle ouput.
+ **/
+void ToolsGetAttachmentByIndex(const int entityIndex, const int iAttach, float vOrigin[3], float vAngle[3])
+{
+    // Validate windows
+    if(GameEnginePlatform(OS_Windows))
+    {
+        // Gets the name of the index, windows signature takes only the name
+        static char sKey[PLATFORM_MAX_PATH]; static char sAttach[SMALL_LINE_LENGTH];
+        GetEntPropString(entityIndex, Prop_Data, "m_ModelName", sKey, sizeof(sKey));
+        Format(sKey, sizeof(sKey), "%s#%d", sKey, iAttach);
+        if(trieToolsAttachments.GetString(sKey, sAttach, sizeof(sAttach)))
         {
-            SDKCall(hSDKCallGetAttachment_Linux, entityIndex, iAnimating, vOrigin, vAngle); 
+            SDKCall(hSDKCallGetAttachment_Windows, entityIndex, sAttach, vOrigin, vAngle); 
         }
     }
+    else
+    {
+        SDKCall(hSDKCallGetAttachment_Linux, entityIndex, iAttach, vOrigin, vAngle); 
+    }
 }
\ No newline at end of file
@@ -163,6 +163,9 @@ enum ClientData
     Client_DataID,
     Client_Costume,
     Client_Time,
+    Client_Kills,
+    Client_Infections,
+    Client_Rank,
     Client_AttachmentCostume,
     Client_AttachmentBits,
     Client_AttachmentAddons[11], /* Amount of weapon back attachments */
@@ -173,6 +176,7 @@ enum ClientData
     Client_CustomWeapon,
     Client_DrawSequence,
     Client_WeaponIndex,
+    Client_WeaponHooks,
     bool:Client_ToggleSequence,
     Client_LastSequenceParity,
     Client_SwapWeapon,
@@ -180,7 +184,6 @@ enum ClientData
     /* Timers */
     Handle:Client_LevelTimer,
     Handle:Client_AccountTimer,
-    Handle:Client_RespawnTimer,
     Handle:Client_SkillTimer,
     Handle:Client_CountDownTimer,
     Handle:Client_HealTimer,
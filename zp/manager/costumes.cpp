@@ -139,7 +139,8 @@ void CostumesLoad(/*void*/)
     ConfigSetConfigPath(File_Costumes, sCostumePath);
 
     // Load config from file and create array structure
-    bool bSuccess = ConfigLoadConfig(File_Costumes, arrayCostumes);
+    bool bCached;
+    bool bSuccess = ConfigLoadConfig(File_Costumes, arrayCostumes, _, bCached);
 
     // Unexpected error, stop plugin
     if(!bSuccess)
@@ -156,8 +157,8 @@ void CostumesLoad(/*void*/)
         return;
     }
 
-    // Now copy data to array structure
-    CostumesCacheData();
+    // Now copy data to array structure, or only precache the kept data
+    if(bCached) CostumesPrecacheData(); else CostumesCacheData();
 
     // Sets config data
     ConfigSetConfigLoaded(File_Costumes, true);
@@ -197,32 +198,73 @@ void CostumesCacheData(/*void*/)
             continue;
         }
         
-        // Validate translation
-        if(!TranslationPhraseExists(sCostumesPath))
-        {
-            // Log costume error
-            LogEvent(false, LogType_Error, LOG_CORE_EVENTS, LogModule_Costumes, "Config Validation", "Couldn't cache costume name: \"%s\" (check translation file)", sCostumesPath);
-        }
+        // Cache the entry
+        CostumesOnCacheEntry(kvCostumes, i);
+    }
+    
+    // We're done with this file now, so we can close it
+    delete kvCostumes;
+}
 
-        // Gets array size
+/**
+ * Precaches the costume data, which was kept from the previous map.
+ **/
+void CostumesPrecacheData(/*void*/)
+{
+    // Initialize variable
+    static char sCostumesPath[PLATFORM_MAX_PATH];
+    
+    // i = array index
+    int iSize = arrayCostumes.Length;
+    for(int i = 0; i < iSize; i++)
+    {
+        // Validate the cached entry
         ArrayList arrayCostume = arrayCostumes.Get(i);
+        if(arrayCostume.Length <= 1)
+        {
+            continue;
+        }
         
-        // Push data into array
-        kvCostumes.GetString("model", sCostumesPath, sizeof(sCostumesPath), ""); 
-        arrayCostume.PushString(sCostumesPath);          // Index: 1
+        // Precache the model
+        CostumesGetModel(i, sCostumesPath, sizeof(sCostumesPath));
         ModelsPrecacheStatic(sCostumesPath);
-        arrayCostume.Push(kvCostumes.GetNum("body", 0)); // Index: 2
-        arrayCostume.Push(kvCostumes.GetNum("skin", 0)); // Index: 3
-        kvCostumes.GetString("attachment", sCostumesPath, sizeof(sCostumesPath), "facemask");  
-        arrayCostume.PushString(sCostumesPath);          // Index: 4
-        kvCostumes.GetString("group", sCostumesPath, sizeof(sCostumesPath), "");  
-        arrayCostume.PushString(sCostumesPath);          // Index: 5
-        arrayCostume.Push(ConfigKvGetStringBool(kvCostumes, "hide", "no")); // Index: 6
-        arrayCostume.Push(kvCostumes.GetNum("level", 0)); // Index: 7
     }
+}
+
+/**
+ * Caches the data of one costume from the keyvalue section.
+ *
+ * @param kvCostumes        The keyvalue handle, which is on the costume section.
+ * @param iD                The costume index.
+ **/
+public void CostumesOnCacheEntry(KeyValues kvCostumes, int iD)
+{
+    // Gets the costume name
+    static char sCostumesPath[PLATFORM_MAX_PATH];
+    CostumesGetName(iD, sCostumesPath, sizeof(sCostumesPath));
+
+    // Validate translation
+    if(!TranslationPhraseExists(sCostumesPath))
+    {
+        // Log costume error
+        LogEvent(false, LogType_Error, LOG_CORE_EVENTS, LogModule_Costumes, "Config Validation", "Couldn't cache costume name: \"%s\" (check translation file)", sCostumesPath);
+    }
+
+    // Gets array size
+    ArrayList arrayCostume = arrayCostumes.Get(iD);
     
-    // We're done with this file now, so we can close it
-    delete kvCostumes;
+    // Push data into array
+    kvCostumes.GetString("model", sCostumesPath, sizeof(sCostumesPath), ""); 
+    arrayCostume.PushString(sCostumesPath);          // Index: 1
+    ModelsPrecacheStatic(sCostumesPath);
+    arrayCostume.Push(kvCostumes.GetNum("body", 0)); // Index: 2
+    arrayCostume.Push(kvCostumes.GetNum("skin", 0)); // Index: 3
+    kvCostumes.GetString("attachment", sCostumesPath, sizeof(sCostumesPath), "facemask");  
+    arrayCostume.PushString(sCostumesPath);          // Index: 4
+    kvCostumes.GetString("group", sCostumesPath, sizeof(sCostumesPath), "");  
+    arrayCostume.PushString(sCostumesPath);          // Index: 5
+    arrayCostume.Push(ConfigKvGetStringBool(kvCostumes, "hide", "no")); // Index: 6
+    arrayCostume.Push(kvCostumes.GetNum("level", 0)); // Index: 7
 }
 
 /**
@@ -230,8 +272,8 @@ void CostumesCacheData(/*void*/)
  **/
 public void CostumesOnConfigReload(/*void*/)
 {
-    // Reload costumes config
-    CostumesLoad();
+    // Reload only the changed costumes
+    ConfigReloadKeyvalue(File_Costumes, arrayCostumes, GetFunctionByName(GetMyHandle(), "CostumesOnCacheEntry"));
 }
 
 /*
@@ -689,6 +731,9 @@ void CostumesMenu(const int clientIndex)
     int iSize = arrayCostumes.Length;
     for(int i = 0; i < iSize; i++)
     {
+        // Skip the costume, which was removed by the reload
+        if(ConfigIsEntryRemoved(File_Costumes, i)) continue;
+        
         // Call forward
         resultHandle = API_OnClientValidateCostume(clientIndex, i);
         
@@ -832,7 +877,7 @@ public void CostumesCreateEntity(const int clientIndex)
         int iSize = arrayCostumes.Length;
 
         // Validate costume
-        if(gClientData[clientIndex][Client_Costume] == -1 || iSize <= gClientData[clientIndex][Client_Costume])
+        if(gClientData[clientIndex][Client_Costume] == -1 || iSize <= gClientData[clientIndex][Client_Costume] || ConfigIsEntryRemoved(File_Costumes, gClientData[clientIndex][Client_Costume]))
         {
             gClientData[clientIndex][Client_Costume] = -1;
             return;
@@ -894,7 +939,7 @@ public void CostumesCreateEntity(const int clientIndex)
                 AcceptEntityInput(entityIndex, "SetParentAttachment", clientIndex, entityIndex);
                 
                 // Hook entity callbacks
-                if(CostumesIsHide(gClientData[clientIndex][Client_Costume])) SDKHook(entityIndex, SDKHook_SetTransmit, CostumesOnTransmit);
+                if(CostumesIsHide(gClientData[clientIndex][Client_Costume])) SDKHook(entityIndex, SDKHook_SetTransmit, DebugOnCostumeTransmit);
                 
                 // Store the client cache
                 gClientData[clientIndex][Client_AttachmentCostume] = EntIndexToEntRef(entityIndex);
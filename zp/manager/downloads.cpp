@@ -25,11 +25,120 @@
  * ============================================================================
  **/
  
+/**
+ * @section Manifest properties.
+ **/
+#define DOWNLOADS_MANIFEST_PATH     "data/zombieplague_downloads.txt"
+/**
+ * @endsection
+ **/
+ 
+/**
+ * @section Manifest resource types.
+ **/
+#define DOWNLOADS_RESOURCE_FILE     'F'    /** Plain file, which is only added to the download table. */
+#define DOWNLOADS_RESOURCE_SOUND    'S'    /** Sound, which is precached by the sound quirk. */
+#define DOWNLOADS_RESOURCE_MODEL    'M'    /** Model, which is precached with its own resources. */
+#define DOWNLOADS_RESOURCE_PARTICLE 'P'    /** Particle file, which effects are precached. */
+#define DOWNLOADS_RESOURCE_MATERIAL 'T'    /** Material, which textures are precached. */
+#define DOWNLOADS_RESOURCE_INVALID  'X'    /** File without format. */
+/**
+ * @endsection
+ **/
+
+/**
+ * Manifest directory data block.
+ **/
+enum DownloadsManifestData
+{
+    DownloadsManifest_Time,
+    DownloadsManifest_Load,
+    Handle:DownloadsManifest_List
+}
+
+/**
+ * Manifest file data block.
+ **/
+enum DownloadsFileData
+{
+    DownloadsFile_Size,
+    DownloadsFile_Time,
+    DownloadsFile_Type,
+    String:DownloadsFile_Path[PLATFORM_MAX_PATH]
+}
+
+/**
+ * Statistics data block of the last load.
+ **/
+enum DownloadsStatsData
+{
+    DownloadsStats_Files,
+    DownloadsStats_Invalid,
+    DownloadsStats_Cached,
+    DownloadsStats_Scanned,
+    DownloadsStats_Bytes,
+    Float:DownloadsStats_Time
+}
+ 
 /**
  * Array handle to store downloadtable config data.
  **/
 ArrayList arrayDownloads;
 
+/**
+ * Trie to store the manifest directories. (path -> [time, list])
+ **/
+StringMap trieDownloadsManifest;
+
+/**
+ * True if the manifest was changed since the last save.
+ **/
+bool gDownloadsManifestChanged;
+
+/**
+ * Number of the current load, the directories which weren't visited by it are pruned.
+ **/
+int gDownloadsManifestLoad;
+
+/**
+ * Array to store the statistics of the last load.
+ **/
+int gDownloadsStats[DownloadsStatsData];
+
+/**
+ * Initialize the downloads manifest.
+ **/
+void DownloadsInit(/*void*/)
+{
+    // Initialize the trie of directories
+    trieDownloadsManifest = CreateTrie();
+    
+    // Read the manifest
+    DownloadsManifestRead();
+}
+
+/**
+ * Save the downloads manifest, if it was changed.
+ **/
+void DownloadsSave(/*void*/)
+{
+    // Validate changes
+    if(gDownloadsManifestChanged)
+    {
+        // Write the manifest
+        DownloadsManifestWrite();
+    }
+}
+
+/**
+ * Creates commands for downloads module. Called when commands are created.
+ **/
+void DownloadsOnCommandsCreate(/*void*/)
+{
+    // Hook commands
+    RegAdminCmd("zp_downloads_stats", DownloadsStatsCommandCatched, ADMFLAG_GENERIC, "Prints the statistics of the last downloads load.");
+}
+
 /**
  * Prepare all model/download data.
  **/
@@ -68,6 +177,11 @@ void DownloadsLoad(/*void*/)
     int iDownloadCount;
     int iDownloadValidCount;
     int iDownloadUnValidCount;
+    int iDownloadBlockUnValidCount;
+    
+    // Resets the statistics
+    int iStats[DownloadsStatsData]; gDownloadsStats = iStats;
+    float flStartTime = GetEngineTime();
     
     // Validate downloads config
     int iDownloads = iDownloadCount = arrayDownloads.Length;
@@ -76,6 +190,10 @@ void DownloadsLoad(/*void*/)
         LogEvent(false, LogType_Fatal, LOG_CORE_EVENTS, LogModule_Downloads, "Config Validation", "No usable data found in downloads config file: \"%s\"", sDownloadsPath);
     }
 
+    // Initialize variables
+    int iFile[DownloadsFileData]; ArrayList hList; bool bCached;
+    gDownloadsManifestLoad++;
+
     // i = download array index
     for(int i = 0; i < iDownloads; i++)
     {
@@ -87,70 +205,66 @@ void DownloadsLoad(/*void*/)
         {
             // Add to server precache list
             if(DownloadsOnPrecache(sDownloadsPath)) iDownloadValidCount++; else iDownloadUnValidCount++;
+            
+            // Update the size
+            int iSize = FileSize(sDownloadsPath);
+            if(iSize > 0) gDownloadsStats[DownloadsStats_Bytes] += iSize;
         }
         // If doesn't exist, it might be directory ?
         else
         {
-            // Open directory
-            DirectoryListing hDirectory = OpenDirectory(sDownloadsPath);
-            
-            // If directory doesn't exist, then log, and stop
-            if(hDirectory == INVALID_HANDLE)
+            // Validate the directory stamp
+            bCached = DownloadsManifestGet(sDownloadsPath, hList);
+            if(bCached)
+            {
+                // Update the counter
+                gDownloadsStats[DownloadsStats_Cached]++;
+            }
+            // If directory was changed, then rescan it
+            else if(hList == null || !DownloadsManifestScan(sDownloadsPath, hList))
             {
                 // Log download error info
                 LogEvent(false, LogType_Error, LOG_CORE_EVENTS, LogModule_Downloads, "Config Validation", "Incorrect path \"%s\"", sDownloadsPath);
                 
-                // Remove download from array
-                arrayDownloads.Erase(i);
-
-                // Subtract one from count
-                iDownloads--;
-
-                // Backtrack one index, because we deleted it out from under the loop
-                i--;
+                // Count the block, it is kept, because the array is reused until the config is changed
+                iDownloadBlockUnValidCount++;
                 continue;
             }
+            else
+            {
+                // Update the counter
+                gDownloadsStats[DownloadsStats_Scanned]++;
+            }
     
-            // Initialize variables
-            static char sFile[PLATFORM_MAX_PATH];
-            
-            // Initialize types
-            FileType hType;
-            
-            // Search any files in the directory and precache them
-            while(hDirectory.GetNext(sFile, sizeof(sFile), hType)) 
+            // x = file index
+            int iSize = hList.Length;
+            for(int x = 0; x < iSize; x++)
             {
-                // Switch type
-                switch(hType) 
-                {
-                    case FileType_File :
-                    {
-                        // Format full path to file
-                        Format(sFile, sizeof(sFile), "%s%s", sDownloadsPath, sFile);
-                        
-                        // Add to server precache list
-                        if(DownloadsOnPrecache(sFile)) iDownloadValidCount++; else iDownloadUnValidCount++;
-                    }
-                    
-                    /*case FileType_Unknown :
-                    {
-                        
-                    }
-                    
-                    case FileType_Directory : 
-                    {
-                        
-                    }*/
-                }
+                // Gets the file
+                hList.GetArray(x, iFile, sizeof(iFile));
+                
+                // Validate the file stamp, the directory stamp isn't changed by the rewrite of the file
+                if(bCached) DownloadsManifestValidateFile(hList, x, iFile);
+                
+                // Add to server precache list
+                if(DownloadsOnPrecache(iFile[DownloadsFile_Path], iFile[DownloadsFile_Type])) iDownloadValidCount++; else iDownloadUnValidCount++;
+                
+                // Update the size
+                gDownloadsStats[DownloadsStats_Bytes] += iFile[DownloadsFile_Size];
             }
-        
-            // Close directory
-            delete hDirectory;
         }
     }
     
+    // Remove the directories, which aren't in the config anymore
+    DownloadsManifestPrune();
+    
+    // Store the statistics
+    gDownloadsStats[DownloadsStats_Files] = iDownloadValidCount;
+    gDownloadsStats[DownloadsStats_Invalid] = iDownloadUnValidCount;
+    gDownloadsStats[DownloadsStats_Time] = GetEngineTime() - flStartTime;
+    
     // Log download validation info
-    LogEvent(true, LogType_Normal, LOG_CORE_EVENTS, LogModule_Downloads, "Config Validation", "Total blocks: %d | Unsuccessful blocks: %d | Total: %d | Successful: %d | Unsuccessful: %d", iDownloadCount, iDownloadCount - iDownloads, iDownloadValidCount + iDownloadUnValidCount, iDownloadValidCount, iDownloadUnValidCount);
+    LogEvent(true, LogType_Normal, LOG_CORE_EVENTS, LogModule_Downloads, "Config Validation", "Total blocks: %d | Unsuccessful blocks: %d | Total: %d | Successful: %d | Unsuccessful: %d | Cached directories: %d | Scanned directories: %d", iDownloadCount, iDownloadBlockUnValidCount, iDownloadValidCount + iDownloadUnValidCount, iDownloadValidCount, iDownloadUnValidCount, gDownloadsStats[DownloadsStats_Cached], gDownloadsStats[DownloadsStats_Scanned]);
     
     // Sets config data
     ConfigSetConfigLoaded(File_Downloads, true);
@@ -170,48 +284,435 @@ public void DownloadsOnConfigReload(ConfigFile iConfig)
 }
 
 /**
- * Adds file to the download table.
+ * Console command callback (zp_downloads_stats)
+ * Prints the statistics of the last downloads load.
+ * 
+ * @param clientIndex       The client index.
+ * @param iArguments        The number of arguments that were in the argument string.
+ **/ 
+public Action DownloadsStatsCommandCatched(const int clientIndex, const int iArguments)
+{
+    // Print the statistics
+    ReplyToCommand(clientIndex, "Files: %d | Unsuccessful: %d | Size: %.2f MB", gDownloadsStats[DownloadsStats_Files], gDownloadsStats[DownloadsStats_Invalid], float(gDownloadsStats[DownloadsStats_Bytes]) / 1048576.0);
+    ReplyToCommand(clientIndex, "Cached directories: %d | Scanned directories: %d | Manifest directories: %d", gDownloadsStats[DownloadsStats_Cached], gDownloadsStats[DownloadsStats_Scanned], trieDownloadsManifest.Size);
+    ReplyToCommand(clientIndex, "Time spent: %.3f ms", gDownloadsStats[DownloadsStats_Time] * 1000.0);
+    return Plugin_Handled;
+}
+
+/**
+ * Gets the resource type of the file by its format.
  *
  * @param sPath             The path to file.
- * @return                  True or false.
+ * @return                  The resource type.
  **/
-stock bool DownloadsOnPrecache(const char[] sPath)
+stock int DownloadsGetType(const char[] sPath)
 {
     // Finds the first occurrence of a character in a string
     int iFormat = FindCharInString(sPath, '.', true);
     
-    // If path is don't have format, then log, and stop
+    // If path is don't have format, then stop
     if(iFormat == -1)
     {
-        LogEvent(false, LogType_Error, LOG_CORE_EVENTS, LogModule_Engine, "Config Validation", "Missing file format: %s", sPath);
-        return false;
+        return DOWNLOADS_RESOURCE_INVALID;
     }
     
     // Validate sound format
     if(!strcmp(sPath[iFormat], ".mp3", false) || !strcmp(sPath[iFormat], ".wav", false))
     {
-        // Precache sound
-        return fnPrecacheSoundQuirk(sPath);
+        return DOWNLOADS_RESOURCE_SOUND;
     }
     // Validate model format
     else if(!strcmp(sPath[iFormat], ".mdl", false))
     {
-        // Precache model
-        return ModelsPrecacheStatic(sPath) ? true : false;   
+        return DOWNLOADS_RESOURCE_MODEL;
     }
     // Validate particle format 
     else if(!strcmp(sPath[iFormat], ".pcf", false))
     {
-        // Precache paricle
-        return ModelsPrecacheParticle(sPath);
+        return DOWNLOADS_RESOURCE_PARTICLE;
     }
     // Validate meterial format
     else if(!strcmp(sPath[iFormat], ".vmt", false))
     {
+        return DOWNLOADS_RESOURCE_MATERIAL;
+    }
+    
+    // Return the plain file
+    return DOWNLOADS_RESOURCE_FILE;
+}
+
+/**
+ * Adds file to the download table.
+ *
+ * @param sPath             The path to file.
+ * @param iType             (Optional) The resource type, or 0 to detect it by the format.
+ * @return                  True or false.
+ **/
+stock bool DownloadsOnPrecache(const char[] sPath, int iType = 0)
+{
+    // Validate type
+    if(!iType)
+    {
+        iType = DownloadsGetType(sPath);
+    }
+    
+    // Switch type
+    switch(iType)
+    {
+        // If path is don't have format, then log, and stop
+        case DOWNLOADS_RESOURCE_INVALID :
+        {
+            LogEvent(false, LogType_Error, LOG_CORE_EVENTS, LogModule_Engine, "Config Validation", "Missing file format: %s", sPath);
+            return false;
+        }
+        
+        // Precache sound
+        case DOWNLOADS_RESOURCE_SOUND :
+        {
+            return fnPrecacheSoundQuirk(sPath);
+        }
+        
+        // Precache model
+        case DOWNLOADS_RESOURCE_MODEL :
+        {
+            return ModelsPrecacheStatic(sPath) ? true : false;
+        }
+        
+        // Precache paricle
+        case DOWNLOADS_RESOURCE_PARTICLE :
+        {
+            return ModelsPrecacheParticle(sPath);
+        }
+        
         // Precache textures
-        return ModelsPrecacheTextures(sPath);
+        case DOWNLOADS_RESOURCE_MATERIAL :
+        {
+            return ModelsPrecacheTextures(sPath);
+        }
     }
     
     // Return on success
     return true;
-}
\ No newline at end of file
+}
+
+/**
+ * Gets the manifest entry of the directory, and resets it if the directory was changed.
+ *
+ * @param sPath             The directory path.
+ * @param hList             The file list output, or null if the directory doesn't exist.
+ * @return                  True if the entry is valid, false if it should be rescanned.
+ **/
+bool DownloadsManifestGet(const char[] sPath, ArrayList &hList)
+{
+    // Initialize variable
+    static char sDirectory[PLATFORM_MAX_PATH];
+    strcopy(sDirectory, sizeof(sDirectory), sPath);
+    
+    // Remove the trailing slash, some platforms can't stat it
+    int iLength = strlen(sDirectory);
+    if(iLength > 1 && (sDirectory[iLength - 1] == '/' || sDirectory[iLength - 1] == '\\'))
+    {
+        sDirectory[iLength - 1] = '\0';
+    }
+    
+    // Gets the directory stamp, which is changed on any add, remove or rename of its files
+    int iTime = GetFileTime(sDirectory, FileTime_LastChange);
+    
+    // Initialize the entry
+    int iEntry[DownloadsManifestData];
+
+    // Validate directory
+    if(iTime == -1)
+    {
+        // Remove the outdated entry
+        if(trieDownloadsManifest.GetArray(sPath, iEntry, sizeof(iEntry)))
+        {
+            delete iEntry[DownloadsManifest_List];
+            trieDownloadsManifest.Remove(sPath);
+            gDownloadsManifestChanged = true;
+        }
+
+        hList = null;
+        return false;
+    }
+
+    // Gets the entry
+    if(trieDownloadsManifest.GetArray(sPath, iEntry, sizeof(iEntry)))
+    {
+        // Gets the list
+        hList = view_as<ArrayList>(iEntry[DownloadsManifest_List]);
+        
+        // Mark the entry as visited
+        iEntry[DownloadsManifest_Load] = gDownloadsManifestLoad;
+        
+        // Validate stamp
+        if(iEntry[DownloadsManifest_Time] == iTime)
+        {
+            trieDownloadsManifest.SetArray(sPath, iEntry, sizeof(iEntry));
+            return true;
+        }
+        
+        // Clear the list
+        hList.Clear();
+    }
+    else
+    {
+        // Initialize the list
+        hList = CreateArray(view_as<int>(DownloadsFileData));
+    }
+    
+    // Store the entry
+    iEntry[DownloadsManifest_Time] = iTime;
+    iEntry[DownloadsManifest_Load] = gDownloadsManifestLoad;
+    iEntry[DownloadsManifest_List] = hList;
+    trieDownloadsManifest.SetArray(sPath, iEntry, sizeof(iEntry));
+    
+    // Sets on the changes
+    gDownloadsManifestChanged = true;
+    return false;
+}
+
+/**
+ * Updates the size of the cached file, if the file was changed.
+ *
+ * @param hList             The file list.
+ * @param iD                The file index.
+ * @param iFile             The file data, updated in place.
+ **/
+void DownloadsManifestValidateFile(ArrayList hList, const int iD, int iFile[DownloadsFileData])
+{
+    // Gets the file stamp
+    int iTime = GetFileTime(iFile[DownloadsFile_Path], FileTime_LastChange);
+    
+    // Validate stamp
+    if(iFile[DownloadsFile_Time] == iTime)
+    {
+        return;
+    }
+    
+    // Update the file data
+    iFile[DownloadsFile_Size] = FileSize(iFile[DownloadsFile_Path]);
+    iFile[DownloadsFile_Time] = iTime;
+    hList.SetArray(iD, iFile, sizeof(iFile));
+    
+    // Sets on the changes
+    gDownloadsManifestChanged = true;
+}
+
+/**
+ * Removes the directories, which weren't visited by the current load.
+ **/
+void DownloadsManifestPrune(/*void*/)
+{
+    // Initialize variables
+    static char sPath[PLATFORM_MAX_PATH]; int iEntry[DownloadsManifestData];
+    
+    // Gets the entry keys
+    StringMapSnapshot hSnapshot = trieDownloadsManifest.Snapshot();
+    
+    // i = entry index
+    int iSize = hSnapshot.Length;
+    for(int i = 0; i < iSize; i++)
+    {
+        // Gets the entry
+        hSnapshot.GetKey(i, sPath, sizeof(sPath));
+        trieDownloadsManifest.GetArray(sPath, iEntry, sizeof(iEntry));
+        
+        // Validate visit
+        if(iEntry[DownloadsManifest_Load] == gDownloadsManifestLoad)
+        {
+            continue;
+        }
+        
+        // Remove the entry
+        delete iEntry[DownloadsManifest_List];
+        trieDownloadsManifest.Remove(sPath);
+        gDownloadsManifestChanged = true;
+    }
+    
+    // Close snapshot
+    delete hSnapshot;
+}
+
+/**
+ * Scans the files of the directory into the manifest entry.
+ *
+ * @param sPath             The directory path.
+ * @param hList             The file list.
+ * @return                  True on success, false if the directory can't be opened.
+ **/
+bool DownloadsManifestScan(const char[] sPath, ArrayList hList)
+{
+    // Open directory
+    DirectoryListing hDirectory = OpenDirectory(sPath);
+    
+    // If directory doesn't exist, then remove the entry
+    if(hDirectory == INVALID_HANDLE)
+    {
+        trieDownloadsManifest.Remove(sPath);
+        delete hList;
+        return false;
+    }
+    
+    // Initialize variables
+    static char sFile[PLATFORM_MAX_PATH]; int iFile[DownloadsFileData]; FileType hType;
+    
+    // Search any files in the directory and store them
+    while(hDirectory.GetNext(sFile, sizeof(sFile), hType)) 
+    {
+        // Validate file
+        if(hType == FileType_File)
+        {
+            // Format full path to file
+            Format(iFile[DownloadsFile_Path], PLATFORM_MAX_PATH, "%s%s", sPath, sFile);
+            
+            // Store the file data
+            iFile[DownloadsFile_Size] = FileSize(iFile[DownloadsFile_Path]);
+            iFile[DownloadsFile_Time] = GetFileTime(iFile[DownloadsFile_Path], FileTime_LastChange);
+            iFile[DownloadsFile_Type] = DownloadsGetType(iFile[DownloadsFile_Path]);
+            hList.PushArray(iFile, sizeof(iFile));
+        }
+    }
+
+    // Close directory
+    delete hDirectory;
+    return true;
+}
+
+/**
+ * Reads the manifest file into the trie.
+ **/
+void DownloadsManifestRead(/*void*/)
+{
+    // Build full path in return string
+    static char sPath[PLATFORM_MAX_PATH];
+    BuildPath(Path_SM, sPath, sizeof(sPath), DOWNLOADS_MANIFEST_PATH);
+    
+    // Open the file
+    File hBase = OpenFile(sPath, "rt");
+    
+    // If doesn't exist stop
+    if(hBase == INVALID_HANDLE)
+    {
+        return;
+    }
+    
+    // Initialize variables
+    static char sLine[PLATFORM_MAX_PATH]; static char sValue[4][PLATFORM_MAX_PATH]; int iEntry[DownloadsManifestData]; int iFile[DownloadsFileData];
+    
+    // Read the headers (path|time|count)
+    while(hBase.ReadLine(sLine, sizeof(sLine)))
+    {
+        // Trim off whitespace
+        TrimString(sLine);
+        
+        // Validate header
+        if(ExplodeString(sLine, "|", sValue, 3, sizeof(sValue[])) != 3)
+        {
+            continue;
+        }
+        
+        // Gets the directory
+        iEntry[DownloadsManifest_Time] = StringToInt(sValue[1]);
+        int iCount = StringToInt(sValue[2]);
+        strcopy(sPath, sizeof(sPath), sValue[0]);
+        
+        // Initialize the list
+        ArrayList hList = CreateArray(view_as<int>(DownloadsFileData));
+        
+        // i = file index
+        for(int i = 0; i < iCount; i++)
+        {
+            // Read line
+            if(!hBase.ReadLine(sLine, sizeof(sLine)))
+            {
+                break;
+            }
+            
+            // Trim off whitespace
+            TrimString(sLine);
+            
+            // Read the file (path|size|time|type)
+            if(ExplodeString(sLine, "|", sValue, sizeof(sValue), sizeof(sValue[])) != sizeof(sValue))
+            {
+                continue;
+            }
+            
+            // Push the file
+            strcopy(iFile[DownloadsFile_Path], PLATFORM_MAX_PATH, sValue[0]);
+            iFile[DownloadsFile_Size] = StringToInt(sValue[1]);
+            iFile[DownloadsFile_Time] = StringToInt(sValue[2]);
+            iFile[DownloadsFile_Type] = sValue[3][0];
+            hList.PushArray(iFile, sizeof(iFile));
+        }
+        
+        // Replace the duplicate entry
+        int iDuplicate[DownloadsManifestData];
+        if(trieDownloadsManifest.GetArray(sPath, iDuplicate, sizeof(iDuplicate)))
+        {
+            delete iDuplicate[DownloadsManifest_List];
+        }
+        
+        // Store the entry
+        iEntry[DownloadsManifest_List] = hList;
+        trieDownloadsManifest.SetArray(sPath, iEntry, sizeof(iEntry));
+    }
+    
+    // Close file
+    delete hBase;
+}
+
+/**
+ * Writes the manifest file from the trie.
+ **/
+void DownloadsManifestWrite(/*void*/)
+{
+    // Build full path in return string
+    static char sPath[PLATFORM_MAX_PATH];
+    BuildPath(Path_SM, sPath, sizeof(sPath), DOWNLOADS_MANIFEST_PATH);
+    
+    // Create the file
+    File hBase = OpenFile(sPath, "wt");
+    
+    // If doesn't exist stop
+    if(hBase == INVALID_HANDLE)
+    {
+        LogEvent(false, LogType_Error, LOG_CORE_EVENTS, LogModule_Downloads, "Config Validation", "Error opening file: \"%s\"", sPath);
+        return;
+    }
+    
+    // Initialize variables
+    int iEntry[DownloadsManifestData]; int iFile[DownloadsFileData];
+    
+    // Gets the entry keys
+    StringMapSnapshot hSnapshot = trieDownloadsManifest.Snapshot();
+    
+    // i = entry index
+    int iSize = hSnapshot.Length;
+    for(int i = 0; i < iSize; i++)
+    {
+        // Gets the entry
+        hSnapshot.GetKey(i, sPath, sizeof(sPath));
+        trieDownloadsManifest.GetArray(sPath, iEntry, sizeof(iEntry));
+        ArrayList hList = view_as<ArrayList>(iEntry[DownloadsManifest_List]);
+        
+        // Write the header
+        int iCount = hList.Length;
+        hBase.WriteLine("%s|%d|%d", sPath, iEntry[DownloadsManifest_Time], iCount);
+        
+        // x = file index
+        for(int x = 0; x < iCount; x++)
+        {
+            // Write the file
+            hList.GetArray(x, iFile, sizeof(iFile));
+            hBase.WriteLine("%s|%d|%d|%c", iFile[DownloadsFile_Path], iFile[DownloadsFile_Size], iFile[DownloadsFile_Time], iFile[DownloadsFile_Type]);
+        }
+    }
+    
+    // Close handles
+    delete hSnapshot;
+    delete hBase;
+    
+    // Resets the changes
+    gDownloadsManifestChanged = false;
+}
@@ -64,6 +64,9 @@ void ExtraItemsLoad(/*void*/)
     {
         LogEvent(true, LogType_Normal, LOG_CORE_EVENTS, LogModule_Extraitems, "Extra Items Validation", "No extra items loaded");
     }
+
+    // Rebuild extra items templates
+    MenusPurgeTemplates("items:");
 }
 
 /**
@@ -282,6 +285,9 @@ public int API_RegisterExtraItem(Handle isPlugin, const int iNumParams)
     
     // Store this handle in the main array
     arrayExtraItems.Push(arrayExtraItem);
+
+    // Rebuild extra items templates
+    MenusPurgeTemplates("items:");
     
     // Return id under which we registered the item
     return arrayExtraItems.Length-1;
@@ -705,17 +711,38 @@ void ExtraItemsMenu(const int clientIndex)
         return;
     }
     
+    // Gets the template of the client language
+    static char sKey[SMALL_LINE_LENGTH];
+    FormatEx(sKey, sizeof(sKey), "items:%d", GetClientLanguage(clientIndex));
+    Menu hMenu = MenusGetTemplate(sKey);
+
+    // Validate template
+    if(hMenu == null)
+    {
+        // Build and store the template
+        hMenu = ExtraItemsMenuCreate(clientIndex);
+        MenusSetTemplate(sKey, hMenu);
+    }
+
+    // Display it, the states and counters are patched while drawing
+    hMenu.Display(clientIndex, MENU_TIME_FOREVER); 
+}
+
+/**
+ * Create the extra items menu template in the client language.
+ *  
+ * @param clientIndex        The client index.
+ * @return                   The menu handle.
+ **/ 
+Menu ExtraItemsMenuCreate(const int clientIndex)
+{
     // Initialize variables
     static char sBuffer[NORMAL_LINE_LENGTH];
     static char sName[SMALL_LINE_LENGTH];
     static char sInfo[SMALL_LINE_LENGTH];
-    static char sLevel[SMALL_LINE_LENGTH];
-    static char sLimit[SMALL_LINE_LENGTH];
-    static char sOnline[SMALL_LINE_LENGTH];
-    static char sGroup[SMALL_LINE_LENGTH];
     
     // Create extra items menu handle
-    Menu hMenu = CreateMenu(ExtraItemsSlots);
+    Menu hMenu = CreateMenu(ExtraItemsSlots, MENU_ACTIONS_DEFAULT | MenuAction_DrawItem | MenuAction_DisplayItem);
 
     // Sets the language to target
     SetGlobalTransTarget(clientIndex);
@@ -723,35 +750,19 @@ void ExtraItemsMenu(const int clientIndex)
     // Sets title
     hMenu.SetTitle("%t", "buy extraitems");
     
-    // Initialize forward
-    static Action resultHandle;
-    
     // i = Extra item number
     int iCount = arrayExtraItems.Length;
     for(int i = 0; i < iCount; i++)
     {
-        // Call forward
-        resultHandle = API_OnClientValidateExtraItem(clientIndex, i);
-        
-        // Skip, if item is disabled
-        if(resultHandle == Plugin_Stop)
-        {
-            continue;
-        }
-        
-        // Gets extra item data
+        // Gets extra item name
         ItemsGetName(i, sName, sizeof(sName));
-        ItemsGetGroup(i, sGroup, sizeof(sGroup));
 
         // Format some chars for showing in menu
-        Format(sLevel, sizeof(sLevel), "%t", "level", ItemsGetLevel(i));
-        Format(sLimit, sizeof(sLimit), "%t", "limit", ItemsGetLimit(i));
-        Format(sOnline, sizeof(sOnline), "%t", "online", ItemsGetOnline(i));
-        Format(sBuffer, sizeof(sBuffer), (ItemsGetCost(i)) ? "%t\t%s\t%t" : "%t\t%s", sName, (!IsPlayerInGroup(clientIndex, sGroup) && strlen(sGroup)) ? sGroup : (gClientData[clientIndex][Client_Level] < ItemsGetLevel(i)) ? sLevel : (ItemsGetLimit(i) != 0 && ItemsGetLimit(i) <= ItemsGetLimits(clientIndex, i)) ? sLimit : (fnGetPlaying() < ItemsGetOnline(i)) ? sOnline :  "", "price", ItemsGetCost(i), "ammopack");
+        Format(sBuffer, sizeof(sBuffer), (ItemsGetCost(i)) ? "%t\t\t%t" : "%t\t", sName, "price", ItemsGetCost(i), "ammopack");
 
         // Show option
         IntToString(i, sInfo, sizeof(sInfo));
-        hMenu.AddItem(sInfo, sBuffer, MenuGetItemDraw(resultHandle == Plugin_Handled || (!IsPlayerInGroup(clientIndex, sGroup) && strlen(sGroup)) || gClientData[clientIndex][Client_Level] < ItemsGetLevel(i) || fnGetPlaying() < ItemsGetOnline(i) || (ItemsGetLimit(i) != 0 && ItemsGetLimit(i) <= ItemsGetLimits(clientIndex, i) || gClientData[clientIndex][Client_AmmoPacks] < ItemsGetCost(i)) ? false : true));
+        hMenu.AddItem(sInfo, sBuffer);
     }
     
     // If there are no cases, add an "(Empty)" line
@@ -766,9 +777,9 @@ void ExtraItemsMenu(const int clientIndex)
     // Sets exit and back button
     hMenu.ExitBackButton = true;
     
-    // Sets options and display it
+    // Sets options
     hMenu.OptionFlags = MENUFLAG_BUTTON_EXIT | MENUFLAG_BUTTON_EXITBACK;
-    hMenu.Display(clientIndex, MENU_TIME_FOREVER); 
+    return hMenu;
 }
 
 /**
@@ -784,10 +795,73 @@ public int ExtraItemsSlots(Menu hMenu, MenuAction mAction, const int clientIndex
     // Switch the menu action
     switch(mAction)
     {
-        // Client hit 'Exit' button
-        case MenuAction_End :
+        // Client is viewing an option
+        case MenuAction_DrawItem :
         {
-            delete hMenu;
+            // Initialize variables
+            static char sInfo[SMALL_LINE_LENGTH]; static int iStyle;
+
+            // Gets ID of the extra item
+            hMenu.GetItem(mSlot, sInfo, sizeof(sInfo), iStyle);
+            if(iStyle == ITEMDRAW_DISABLED)
+            {
+                return iStyle;
+            }
+            int iD = StringToInt(sInfo);
+
+            // Call forward
+            Action resultHandle = API_OnClientValidateExtraItem(clientIndex, iD);
+        
+            // Hide, if item is disabled
+            if(resultHandle == Plugin_Stop)
+            {
+                return ITEMDRAW_IGNORE;
+            }
+
+            // Gets extra item group
+            ItemsGetGroup(iD, sInfo, sizeof(sInfo));
+
+            // Patch the state
+            return MenuGetItemDraw(resultHandle == Plugin_Handled || (!IsPlayerInGroup(clientIndex, sInfo) && strlen(sInfo)) || gClientData[clientIndex][Client_Level] < ItemsGetLevel(iD) || fnGetPlaying() < ItemsGetOnline(iD) || (ItemsGetLimit(iD) != 0 && ItemsGetLimit(iD) <= ItemsGetLimits(clientIndex, iD) || gClientData[clientIndex][Client_AmmoPacks] < ItemsGetCost(iD)) ? false : true);
+        }
+
+        // Client is viewing an option text
+        case MenuAction_DisplayItem :
+        {
+            // Initialize variables
+            static char sBuffer[NORMAL_LINE_LENGTH];
+            static char sName[SMALL_LINE_LENGTH];
+            static char sInfo[SMALL_LINE_LENGTH]; static int iStyle;
+
+            // Gets ID of the extra item
+            hMenu.GetItem(mSlot, sInfo, sizeof(sInfo), iStyle);
+            if(iStyle == ITEMDRAW_DISABLED)
+            {
+                return 0;
+            }
+            int iD = StringToInt(sInfo);
+
+            // Sets the language to target
+            SetGlobalTransTarget(clientIndex);
+
+            // Gets extra item group
+            ItemsGetGroup(iD, sInfo, sizeof(sInfo));
+
+            // Format the counter, the template line is kept without it
+            if(IsPlayerInGroup(clientIndex, sInfo) || !strlen(sInfo))
+            {
+                if(gClientData[clientIndex][Client_Level] < ItemsGetLevel(iD)) Format(sInfo, sizeof(sInfo), "%t", "level", ItemsGetLevel(iD));
+                else if(ItemsGetLimit(iD) != 0 && ItemsGetLimit(iD) <= ItemsGetLimits(clientIndex, iD)) Format(sInfo, sizeof(sInfo), "%t", "limit", ItemsGetLimit(iD));
+                else if(fnGetPlaying() < ItemsGetOnline(iD)) Format(sInfo, sizeof(sInfo), "%t", "online", ItemsGetOnline(iD));
+                else return 0;
+            }
+
+            // Gets extra item name
+            ItemsGetName(iD, sName, sizeof(sName));
+
+            // Redraw the option
+            Format(sBuffer, sizeof(sBuffer), (ItemsGetCost(iD)) ? "%t\t%s\t%t" : "%t\t%s", sName, sInfo, "price", ItemsGetCost(iD), "ammopack");
+            return RedrawMenuItem(sBuffer);
         }
         
         // Client hit 'Back' button
@@ -806,7 +880,7 @@ public int ExtraItemsSlots(Menu hMenu, MenuAction mAction, const int clientIndex
             // Validate client
             if(!IsPlayerExist(clientIndex))
             {
-                return;
+                return 0;
             }
             
             // If round ended, then stop
@@ -814,7 +888,7 @@ public int ExtraItemsSlots(Menu hMenu, MenuAction mAction, const int clientIndex
             {
                 // Emit error sound
                 ClientCommand(clientIndex, "play buttons/button11.wav");    
-                return;
+                return 0;
             }
 
             // Initialize variable
@@ -875,4 +949,7 @@ public int ExtraItemsSlots(Menu hMenu, MenuAction mAction, const int clientIndex
             }
         }
     }
+
+    // Template is kept until the reload
+    return 0;
 }
@@ -203,12 +203,18 @@ void GameModesEventStart(int modeIndex = -1, const int selectedIndex = 0)
     // Play game mode sounds
     SoundsInputEmitToAll(ModesGetSoundID(modeIndex), 0, SOUND_FROM_PLAYER, SNDCHAN_STATIC, gCvarList[CVAR_GAME_CUSTOM_SOUND_LEVEL].IntValue);
 
+    // Spread the presentation of the classes across frames
+    ClassSetBatch(true);
+
     // Random players should be zombie
     GameModesTurnIntoZombie(selectedIndex, nMaxZombies);
 
     // Remaining players should be humans
     GameModesTurnIntoHuman();
 
+    // End the batch
+    ClassSetBatch(false);
+
     // Call forward
     API_OnZombieModStarted(modeIndex);
 
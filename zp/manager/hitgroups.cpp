@@ -88,7 +88,8 @@ void HitgroupsLoad(/*void*/)
     ConfigSetConfigPath(File_Hitgroups, sHitgroupPath);
 
     // Load config from file and create array structure
-    bool bSuccess = ConfigLoadConfig(File_Hitgroups, arrayHitgroups);
+    bool bCached;
+    bool bSuccess = ConfigLoadConfig(File_Hitgroups, arrayHitgroups, _, bCached);
 
     // Unexpected error, stop plugin
     if(!bSuccess)
@@ -105,8 +106,8 @@ void HitgroupsLoad(/*void*/)
         LogEvent(false, LogType_Fatal, LOG_CORE_EVENTS, LogModule_Hitgroups, "Config Validation", "No usable data found in hitgroups config file: %s", sHitgroupPath);
     }
 
-    // Now copy data to array structure
-    HitgroupsCacheData();
+    // Now copy data to array structure, unless the data was kept
+    if(!bCached) HitgroupsCacheData();
 
     // Sets config data
     ConfigSetConfigLoaded(File_Hitgroups, true);
@@ -144,26 +145,38 @@ void HitgroupsCacheData(/*void*/)
             continue;
         }
 
-        // Gets array size
-        ArrayList arrayHitgroup = arrayHitgroups.Get(i);
-        
-        // Push data into array
-        arrayHitgroup.Push(kvHitgroups.GetNum("index", -1));                     // Index: 1
-        arrayHitgroup.Push(ConfigKvGetStringBool(kvHitgroups, "damage", "yes")); // Index: 2
-        arrayHitgroup.Push(kvHitgroups.GetFloat("knockback", 1.0));              // Index: 3
+        // Cache the entry
+        HitgroupsOnCacheEntry(kvHitgroups, i);
     }
     
     // We're done with this file now, so we can close it
     delete kvHitgroups;
 }
 
+/**
+ * Caches the data of one hitgroup from the keyvalue section.
+ *
+ * @param kvHitgroups       The keyvalue handle, which is on the hitgroup section.
+ * @param iD                The hitgroup index.
+ **/
+public void HitgroupsOnCacheEntry(KeyValues kvHitgroups, int iD)
+{
+    // Gets array size
+    ArrayList arrayHitgroup = arrayHitgroups.Get(iD);
+    
+    // Push data into array
+    arrayHitgroup.Push(kvHitgroups.GetNum("index", -1));                     // Index: 1
+    arrayHitgroup.Push(ConfigKvGetStringBool(kvHitgroups, "damage", "yes")); // Index: 2
+    arrayHitgroup.Push(kvHitgroups.GetFloat("knockback", 1.0));              // Index: 3
+}
+
 /**
  * Called when configs are being reloaded.
  **/
 public void HitgroupsOnConfigReload(/*void*/)
 {
-    // Reload hitgroups config
-    HitgroupsLoad();
+    // Reload only the changed hitgroups
+    ConfigReloadKeyvalue(File_Hitgroups, arrayHitgroups, GetFunctionByName(GetMyHandle(), "HitgroupsOnCacheEntry"));
 }
 
 /**
@@ -217,6 +230,9 @@ stock int HitgroupToIndex(const int iHitGroup)
     int iSize = arrayHitgroups.Length;
     for(int i = 0; i < iSize; i++)
     {
+        // Skip the hitgroup, which was removed by the reload
+        if(ConfigIsEntryRemoved(File_Hitgroups, i)) continue;
+        
         // Gets hitgroup index at this array index
         int iIndex = HitgroupsGetIndex(i);
         
@@ -30,6 +30,11 @@
  **/
 ArrayList arrayMenus;
 
+/**
+ * Trie to store the translated menu templates. (key -> menu)
+ **/
+StringMap trieMenusTemplates;
+
 /**
  * Menu config data indexes.
  **/
@@ -40,6 +45,15 @@ enum
     MENUS_DATA_COMMAND
 }
 
+/**
+ * Initialize the menu templates.
+ **/
+void MenusInit(/*void*/)
+{
+    // Initialize a template trie
+    trieMenusTemplates = CreateTrie();
+}
+
 /**
  * Creates commands for menu module. Called when commands are created.
  **/
@@ -47,9 +61,6 @@ void MenusOnCommandsCreate(/*void*/)
 {
     // Hook commands
     RegConsoleCmd("zmainmenu", MenusCommandCatched, "Open the main menu.");
-    
-    // Hook listeners
-    AddCommandListener(MenusOnOpen);
 }
 
 /**
@@ -66,28 +77,15 @@ public Action MenusCommandCatched(const int clientIndex, const int iArguments)
 }
 
 /**
- * Callback for command listener to open the main menu.
+ * Called when the menu button is pressed. Routed by the command router.
  *
  * @param clientIndex       The client index.
- * @param commandMsg        Command name, lower case. To get name as typed, use GetCmdArg() and specify argument 0.
- * @param iArguments        Argument count.
  **/
-public Action MenusOnOpen(const int clientIndex, const char[] commandMsg, const int iArguments)
+Action MenusOnOpen(const int clientIndex)
 {
-    // Gets command alias
-    static char sCommand[SMALL_LINE_LENGTH];
-    gCvarList[CVAR_GAME_CUSTOM_MENU_BUTTON].GetString(sCommand, sizeof(sCommand));
-    
-    // Validate command
-    if(!strcmp(sCommand, commandMsg))
-    {
-        // Open the main menu
-        MenuMain(clientIndex);
-        return Plugin_Handled;
-    }
-    
-    // Allow command
-    return Plugin_Continue;
+    // Open the main menu
+    MenuMain(clientIndex);
+    return Plugin_Handled;
 }
 
 /**
@@ -113,7 +111,8 @@ void MenusLoad(/*void*/)
     ConfigSetConfigPath(File_Menus, sMenuPath);
 
     // Load config from file and create array structure
-    bool bSuccess = ConfigLoadConfig(File_Menus, arrayMenus);
+    bool bCached;
+    bool bSuccess = ConfigLoadConfig(File_Menus, arrayMenus, _, bCached);
 
     // Unexpected error, stop plugin
     if(!bSuccess)
@@ -128,16 +127,16 @@ void MenusLoad(/*void*/)
         LogEvent(false, LogType_Fatal, LOG_CORE_EVENTS, LogModule_Menus, "Config Validation", "No usable data found in menus config file: \"%s\"", sMenuPath);
     }
 
-    // Now copy data to array structure
-    MenusCacheData();
+    // Now copy data to array structure, unless the data was kept
+    if(!bCached) MenusCacheData();
 
     // Sets config data
     ConfigSetConfigLoaded(File_Menus, true);
     ConfigSetConfigReloadFunc(File_Menus, GetFunctionByName(GetMyHandle(), "MenusOnConfigReload"));
     ConfigSetConfigHandle(File_Menus, arrayMenus);
-    
-    //
-    
+
+    // Rebuild main menu templates
+    MenusPurgeTemplates("main:");
 }
 
 /**
@@ -172,34 +171,54 @@ void MenusCacheData(/*void*/)
             continue;
         }
         
-        // Validate translation
-        if(!TranslationPhraseExists(sMenusPath))
-        {
-            // Log menu error
-            LogEvent(false, LogType_Error, LOG_CORE_EVENTS, LogModule_Costumes, "Config Validation", "Couldn't cache menu name: \"%s\" (check translation file)", sMenusPath);
-        }
-
-        // Initialize array block
-        ArrayList arrayMenu = arrayMenus.Get(i);
-
-        // Push data into array
-        kvMenus.GetString("group", sMenusPath, sizeof(sMenusPath), "");  
-        arrayMenu.PushString(sMenusPath); // Index: 1
-        kvMenus.GetString("command", sMenusPath, sizeof(sMenusPath), "");
-        arrayMenu.PushString(sMenusPath); // Index: 2
+        // Cache the entry
+        MenusOnCacheEntry(kvMenus, i);
     }
 
     // We're done with this file now, so we can close it
     delete kvMenus;
 }
 
+/**
+ * Caches the data of one menu from the keyvalue section.
+ *
+ * @param kvMenus           The keyvalue handle, which is on the menu section.
+ * @param iD                The menu index.
+ **/
+public void MenusOnCacheEntry(KeyValues kvMenus, int iD)
+{
+    // Gets the menu name
+    static char sMenusPath[PLATFORM_MAX_PATH];
+    MenusGetName(iD, sMenusPath, sizeof(sMenusPath));
+
+    // Validate translation
+    if(!TranslationPhraseExists(sMenusPath))
+    {
+        // Log menu error
+        LogEvent(false, LogType_Error, LOG_CORE_EVENTS, LogModule_Costumes, "Config Validation", "Couldn't cache menu name: \"%s\" (check translation file)", sMenusPath);
+    }
+
+    // Initialize array block
+    ArrayList arrayMenu = arrayMenus.Get(iD);
+
+    // Push data into array
+    kvMenus.GetString("group", sMenusPath, sizeof(sMenusPath), "");  
+    arrayMenu.PushString(sMenusPath); // Index: 1
+    kvMenus.GetString("command", sMenusPath, sizeof(sMenusPath), "");
+    arrayMenu.PushString(sMenusPath); // Index: 2
+}
+
 /**
  * Called when config is being reloaded.
  **/
 public void MenusOnConfigReload(/*void*/)
 {
-    // Reload menus config
-    MenusLoad();
+    // Reload only the changed menus
+    if(ConfigReloadKeyvalue(File_Menus, arrayMenus, GetFunctionByName(GetMyHandle(), "MenusOnCacheEntry")) > 0)
+    {
+        // Rebuild main menu templates
+        MenusPurgeTemplates("main:");
+    }
 }
 
 /*
@@ -377,6 +396,70 @@ stock void MenusGetCommand(const int iD, char[] sCommand, const int iMaxLen)
 /*
  * Stocks menus API.
  */
+
+/**
+ * Gets the menu template by a key.
+ *
+ * @param sKey              The template key. (module:language[:slot])
+ * @return                  The menu handle, or null if not built yet.
+ **/
+Menu MenusGetTemplate(const char[] sKey)
+{
+    // Gets the template
+    Menu hMenu;
+    return trieMenusTemplates.GetValue(sKey, hMenu) ? hMenu : null;
+}
+
+/**
+ * Sets the menu template by a key.
+ *
+ * @param sKey              The template key. (module:language[:slot])
+ * @param hMenu             The menu handle.
+ **/
+void MenusSetTemplate(const char[] sKey, Menu hMenu)
+{
+    // Store the template
+    trieMenusTemplates.SetValue(sKey, hMenu);
+}
+
+/**
+ * Removes all menu templates of the module. Called when the module data is reloaded.
+ *
+ * @param sPrefix           The module key prefix.
+ **/
+void MenusPurgeTemplates(const char[] sPrefix)
+{
+    // Initialize variables
+    static char sKey[SMALL_LINE_LENGTH]; Menu hMenu;
+    int iLen = strlen(sPrefix);
+
+    // Gets the template keys
+    StringMapSnapshot hSnapshot = trieMenusTemplates.Snapshot();
+
+    // i = key index
+    int iSize = hSnapshot.Length;
+    for(int i = 0; i < iSize; i++)
+    {
+        // Gets the key
+        hSnapshot.GetKey(i, sKey, sizeof(sKey));
+
+        // Validate module
+        if(strncmp(sKey, sPrefix, iLen))
+        {
+            continue;
+        }
+
+        // Delete the template, it closes the menu for clients who view it
+        trieMenusTemplates.GetValue(sKey, hMenu);
+        delete hMenu;
+
+        // Remove the key
+        trieMenusTemplates.Remove(sKey);
+    }
+
+    // Close snapshot
+    delete hSnapshot;
+}
  
 /**
  * Create a main menu.
@@ -391,13 +474,38 @@ void MenuMain(const int clientIndex)
         return;
     }
 
+    // Gets the template of the client language
+    static char sKey[SMALL_LINE_LENGTH];
+    FormatEx(sKey, sizeof(sKey), "main:%d", GetClientLanguage(clientIndex));
+    Menu hMenu = MenusGetTemplate(sKey);
+
+    // Validate template
+    if(hMenu == null)
+    {
+        // Build and store the template
+        hMenu = MenuMainCreate(clientIndex);
+        MenusSetTemplate(sKey, hMenu);
+    }
+
+    // Display it, the access is patched while drawing
+    hMenu.Display(clientIndex, MENU_TIME_FOREVER); 
+}
+
+/**
+ * Create a main menu template in the client language.
+ *
+ * @param clientIndex       The client index.
+ * @return                  The menu handle.
+ **/
+Menu MenuMainCreate(const int clientIndex)
+{
     // Initialize variables
     static char sBuffer[NORMAL_LINE_LENGTH];
     static char sName[SMALL_LINE_LENGTH];
     static char sInfo[SMALL_LINE_LENGTH];
 
     // Create menu handle
-    Menu hMenu = CreateMenu(MenuMainSlots);
+    Menu hMenu = CreateMenu(MenuMainSlots, MENU_ACTIONS_DEFAULT | MenuAction_DrawItem);
     
     // Sets the language to target
     SetGlobalTransTarget(clientIndex);
@@ -409,18 +517,18 @@ void MenuMain(const int clientIndex)
     int iSize = arrayMenus.Length;
     for(int i = 0; i < iSize; i++)
     {
+        // Skip the menu, which was removed by the reload
+        if(ConfigIsEntryRemoved(File_Menus, i)) continue;
+        
         // Gets menu name
         MenusGetName(i, sName, sizeof(sName));
 
         // Format some chars for showing in menu
         Format(sBuffer, sizeof(sBuffer), "%t", sName);
 
-        // Gets menu group
-        MenusGetGroup(i, sName, sizeof(sName));
-        
         // Show option
         IntToString(i, sInfo, sizeof(sInfo));
-        hMenu.AddItem(sInfo, sBuffer, MenuGetItemDraw((!IsPlayerInGroup(clientIndex, sName) && strlen(sName)) ? false : true));
+        hMenu.AddItem(sInfo, sBuffer);
     }
     
     // If there are no cases, add an "(Empty)" line
@@ -435,9 +543,9 @@ void MenuMain(const int clientIndex)
     // Sets exit and back button
     hMenu.ExitButton = true;
 
-    // Sets options and display it
+    // Sets options
     hMenu.OptionFlags = MENUFLAG_BUTTON_EXIT;
-    hMenu.Display(clientIndex, MENU_TIME_FOREVER); 
+    return hMenu;
 }
 
 /**
@@ -453,10 +561,24 @@ public int MenuMainSlots(Menu hMenu, MenuAction mAction, const int clientIndex,
     // Switch the menu action
     switch(mAction)
     {
-        // Client hit 'Exit' button
-        case MenuAction_End :
+        // Client is viewing an option
+        case MenuAction_DrawItem :
         {
-            delete hMenu;
+            // Initialize variables
+            static char sInfo[SMALL_LINE_LENGTH]; static int iStyle;
+
+            // Gets ID of menu
+            hMenu.GetItem(mSlot, sInfo, sizeof(sInfo), iStyle);
+            if(iStyle == ITEMDRAW_DISABLED)
+            {
+                return iStyle;
+            }
+
+            // Gets menu group
+            MenusGetGroup(StringToInt(sInfo), sInfo, sizeof(sInfo));
+
+            // Patch the access
+            return MenuGetItemDraw((!IsPlayerInGroup(clientIndex, sInfo) && strlen(sInfo)) ? false : true);
         }
         
         // Client selected an option
@@ -465,7 +587,7 @@ public int MenuMainSlots(Menu hMenu, MenuAction mAction, const int clientIndex,
             // Validate client
             if(!IsPlayerExist(clientIndex, false))
             {
-                return;
+                return 0;
             }
             
             // Initialize command char
@@ -482,6 +604,9 @@ public int MenuMainSlots(Menu hMenu, MenuAction mAction, const int clientIndex,
             FakeClientCommand(clientIndex, sCommand);
         }
     }
+
+    // Template is kept until the reload
+    return 0;
 }
 
 /**
@@ -25,6 +25,78 @@
  * ============================================================================
  **/
  
+/**
+ * @section Manifest properties.
+ **/
+#define MODELS_MANIFEST_PATH        "data/zombieplague_models.txt"
+#define MODELS_MANIFEST_BLOCK       4096
+#define MODELS_MANIFEST_TEXTURES    256
+#define MODELS_MANIFEST_TOUCH       86400      /** Interval in seconds to store the last usage of the entry. */
+#define MODELS_MANIFEST_EXPIRE      2592000    /** Time in seconds after the last usage to remove the entry. */
+/**
+ * @endsection
+ **/
+ 
+/**
+ * @section Manifest resource types.
+ **/
+#define MODELS_RESOURCE_FILE        'F'    /** Sibling file or texture, which is added to the download table. */
+#define MODELS_RESOURCE_SOUND       'S'    /** Sound, which is precached only for the weapon models. */
+#define MODELS_RESOURCE_MATERIAL    'M'    /** Material, which textures are precached from its own entry. */
+#define MODELS_RESOURCE_SEQUENCES   'Q'    /** Sequence swap table of the weapon viewmodel, which isn't a file. */
+/**
+ * @endsection
+ **/
+
+/**
+ * Manifest entry data block.
+ **/
+enum ModelsManifestData
+{
+    Manifest_Size,
+    Manifest_Time,
+    Manifest_Used,
+    Handle:Manifest_List
+}
+
+/**
+ * Trie to store the manifest entries. (path -> [size, time, list])
+ **/
+StringMap trieModelsManifest;
+
+/**
+ * True if the manifest was changed since the last save.
+ **/
+bool gModelsManifestChanged;
+
+/**
+ * Initialize the resource manifest.
+ **/
+void ModelsInit(/*void*/)
+{
+    // Initialize the trie of entries
+    trieModelsManifest = CreateTrie();
+    
+    // Read the manifest
+    ModelsManifestRead();
+}
+
+/**
+ * Save the resource manifest, if it was changed.
+ **/
+void ModelsSave(/*void*/)
+{
+    // Remove the unused entries
+    ModelsManifestPrune();
+    
+    // Validate changes
+    if(gModelsManifestChanged)
+    {
+        // Write the manifest
+        ModelsManifestWrite();
+    }
+}
+
 /**
  * Prepare all model/download data.
  **/
@@ -90,11 +162,8 @@ stock int ModelsPrecacheStatic(const char[] sModel)
     // If model doesn't precache yet, then continue
     if(!IsModelPrecached(sModel))
     {
-        // Precache model materails
-        ModelsPrecacheMaterials(sModel);
-
         // Precache model resources
-        ModelsPrecacheResources(sModel);
+        ModelsPrecacheResources(sModel, false);
     }
     
     // Return on the success
@@ -125,14 +194,8 @@ stock int ModelsPrecacheWeapon(const char[] sModel)
     // If model doesn't precache yet, then continue
     if(!IsModelPrecached(sModel))
     {
-        // Precache model sounds
-        ModelsPrecacheSounds(sModel);
-        
-        // Precache model materails
-        ModelsPrecacheMaterials(sModel);
-        
-        // Precache model resources
-        ModelsPrecacheResources(sModel);
+        // Precache model resources and sounds
+        ModelsPrecacheResources(sModel, true);
     }
     
     // Return the model index
@@ -140,75 +203,66 @@ stock int ModelsPrecacheWeapon(const char[] sModel)
 }
 
 /**
- * Reads the current model and precache its resources.
+ * Precache the model resources from the manifest.
  *
  * @param sModel            The model path.
+ * @param bSounds           If true, the model sounds will be precached too.
+ * @return                  True if was precached, false otherwise.
  **/
-stock void ModelsPrecacheResources(const char[] sModel)
+stock bool ModelsPrecacheResources(const char[] sModel, const bool bSounds)
 {
     // Add file to download table
     AddFileToDownloadsTable(sModel);
 
-    // Initialize some variables
-    static char sResource[PLATFORM_MAX_PATH];
-    static const char sTypes[3][SMALL_LINE_LENGTH] = { ".dx90.vtx", ".phy", ".vvd" };
-
-    // Finds the first occurrence of a character in a string
-    int iFormat = FindCharInString(sModel, '.', true);
-    
-    // i = resource type
-    int iSize = sizeof(sTypes);
-    for(int i = 0; i < iSize; i++)
+    // Gets the manifest entry
+    ArrayList hList;
+    if(!ModelsManifestGet(sModel, hList))
     {
-        // Extract value string
-        StrExtract(sResource, sModel, 0, iFormat);
-        
-        // Concatenates one string onto another
-        StrCat(sResource, sizeof(sResource), sTypes[i]);
+        // Validate model
+        if(hList == INVALID_HANDLE)
+        {
+            LogEvent(false, LogType_Fatal, LOG_CORE_EVENTS, LogModule_Models, "Config Validation", "Error opening file: \"%s\"", sModel);
+            return false;
+        }
         
-        // Validate resource
-        if(FileExists(sResource)) 
+        // Rebuild the entry
+        if(!ModelsManifestBuildModel(sModel, hList))
         {
-            // Add file to download table
-            AddFileToDownloadsTable(sResource);
+            ModelsManifestRemove(sModel);
+            return false;
         }
     }
+    
+    // Precache resources
+    ModelsManifestPrecache(hList, bSounds);
+    return true;
 }
 
 /**
- * Reads the current model and precache its sounds.
+ * Reads the current particle and precache its textures.
  *
  * @param sModel            The model path.
  * @return                  True if was precached, false otherwise.
  **/
-stock bool ModelsPrecacheSounds(const char[] sModel)
+stock bool ModelsPrecacheParticle(const char[] sModel)
 {
-    // Finds the first occurrence of a character in a string
-    int iFormat = FindCharInString(sModel, '.', true);
-    
-    // If model path is don't have format, then log, and stop
-    if(iFormat == -1)
-    {
-        LogEvent(false, LogType_Fatal, LOG_CORE_EVENTS, LogModule_Models, "Config Validation", "Missing file format: %s", sModel);
-        return false;
-    }
-    
-    // Extract value string
-    static char sPath[PLATFORM_MAX_PATH];
-    StrExtract(sPath, sModel, 0, iFormat);
+    // Add file to download table
+    AddFileToDownloadsTable(sModel);
 
-    // Concatenates one string onto another
-    StrCat(sPath, sizeof(sPath), "_sounds.txt");
-    
-    // Validate if a file exists
-    bool bExists = FileExists(sPath);
+    // Precache generic
+    PrecacheGeneric(sModel, true); //! Precache only here
     
-    // Open/Create the file
-    File hBase = OpenFile(sPath, "at+");
-
-    // If file doesn't exist, then write it
-    if(!bExists)
+    // Gets the manifest entry
+    ArrayList hList;
+    if(!ModelsManifestGet(sModel, hList))
     {
+        // Validate particle
+        if(hList == INVALID_HANDLE)
+        {
+            LogEvent(false, LogType_Fatal, LOG_CORE_EVENTS, LogModule_Models, "Config Validation", "Error opening file: \"%s\"", sModel);
+            return false;
+        }
+        
         // Open the file
         File hFile = OpenFile(sModel, "rb");
 
@@ -216,488 +270,692 @@ stock bool ModelsPrecacheSounds(const char[] sModel)
         if(hFile == INVALID_HANDLE)
         {
             LogEvent(false, LogType_Fatal, LOG_CORE_EVENTS, LogModule_Models, "Config Validation", "Error opening file: \"%s\"", sModel);
+            ModelsManifestRemove(sModel);
             return false;
         }
         
-        // Initialize some variables
-        int iChar; ///int iNumSeq;
+        // Store the material strings of the binary
+        ModelsManifestScanStrings(hFile, hList, false);
 
-        // Find the total sequence amount
-        /*
-            hFile.Seek(180, SEEK_SET);
-            hFile.ReadInt32(iNumSeq);
-        */
+        // Close file
+        delete hFile;
+    }
+    
+    // Precache resources
+    ModelsManifestPrecache(hList, false);
+    return true;
+}
+
+/**
+ * Reads the current material and precache its textures.
+ *
+ * @param sPath             The material path.
+ * @return                  True if was precached, false otherwise.
+ **/
+stock bool ModelsPrecacheTextures(const char[] sPath)
+{
+    // Gets the manifest entry
+    ArrayList hList;
+    if(!ModelsManifestGet(sPath, hList))
+    {
+        // If doesn't exist stop
+        if(hList == INVALID_HANDLE)
+        {
+            LogEvent(false, LogType_Error, LOG_CORE_EVENTS, LogModule_Models, "Config Validation", "Invalid material path. File not found: \"%s\"", sPath);
+            return false;
+        }
         
-        do /// Reads a single binary char
+        // Rebuild the entry
+        if(!ModelsManifestBuildMaterial(sPath, hList))
         {
-            hFile.Seek(2, SEEK_CUR);
-            hFile.ReadInt8(iChar);
-        } 
-        while(iChar == 0);
+            ModelsManifestRemove(sPath);
+            return false;
+        }
+    }
 
-        // Shift the cursor a bit
-        hFile.Seek(1, SEEK_CUR);
+    // Add file to download table
+    AddFileToDownloadsTable(sPath);
+    
+    // Precache resources
+    ModelsManifestPrecache(hList, false);
+    return true;
+}
 
-        do /// Reads a single binary char
-        {
-            hFile.Seek(2, SEEK_CUR);
-            hFile.ReadInt8(iChar);
-        } 
-        while(iChar != 0);
+/**
+ * Gets the manifest entry of the file, and resets it if the file was changed.
+ *
+ * @param sPath             The file path.
+ * @param hList             The resource list output, or null if the file doesn't exist.
+ * @return                  True if the entry is valid, false if it should be rebuilt.
+ **/
+bool ModelsManifestGet(const char[] sPath, ArrayList &hList)
+{
+    // Gets the file stamps
+    int iSize = FileSize(sPath);
+    int iTime = GetFileTime(sPath, FileTime_LastChange);
+    
+    // Validate file
+    if(iSize == -1)
+    {
+        // Remove the outdated entry
+        ModelsManifestRemove(sPath);
+        
+        hList = null;
+        return false;
+    }
 
-        // Loop throught the binary
-        while(!hFile.EndOfFile())
+    // Gets the entry
+    int iEntry[ModelsManifestData]; int iUsed = GetTime();
+    if(trieModelsManifest.GetArray(sPath, iEntry, sizeof(iEntry)))
+    {
+        // Gets the list
+        hList = view_as<ArrayList>(iEntry[Manifest_List]);
+        
+        // Validate stamps
+        if(iEntry[Manifest_Size] == iSize && iEntry[Manifest_Time] == iTime)
         {
-            // Reads a UTF8 or ANSI string from a file
-            hFile.ReadString(sPath, sizeof(sPath));
-            
-            // Finds the first occurrence of a character in a string
-            iFormat = FindCharInString(sPath, '.', true);
-
-            // Validate format
-            if(iFormat != -1) 
+            // Update the usage time, it is saved only once per interval
+            if(iUsed - iEntry[Manifest_Used] > MODELS_MANIFEST_TOUCH)
             {
-                // Validate sound format
-                if(!strcmp(sPath[iFormat], ".mp3", false) || !strcmp(sPath[iFormat], ".wav", false))
-                {
-                    // Format full path to file
-                    Format(sPath, sizeof(sPath), "sound/%s", sPath);
-                    
-                    // Store into the base
-                    hBase.WriteLine(sPath);
-                    
-                    // Add file to download table
-                    fnPrecacheSoundQuirk(sPath);
-                }
+                iEntry[Manifest_Used] = iUsed;
+                trieModelsManifest.SetArray(sPath, iEntry, sizeof(iEntry));
+                gModelsManifestChanged = true;
             }
+            return true;
         }
-
-        // Close file
-        delete hFile; 
-        ///return true;
+        
+        // Clear the list
+        hList.Clear();
     }
     else
     {
-        // Read lines in the file
-        while(hBase.ReadLine(sPath, sizeof(sPath)))
-        {
-            // Cut out comments at the end of a line
-            if(StrContains(sPath, "//") != -1)
-            {
-                SplitString(sPath, "//", sPath, sizeof(sPath));
-            }
-            
-            // Trim off whitespace
-            TrimString(sPath);
-
-            // If line is empty, then stop
-            if(!strlen(sPath))
-            {
-                continue;
-            }
-            
-            // Add file to download table
-            fnPrecacheSoundQuirk(sPath);
-        }
+        // Initialize the list
+        hList = CreateArray(ByteCountToCells(PLATFORM_MAX_PATH));
     }
     
-    // Close file
-    delete hBase;
-    return true;
+    // Store the entry
+    iEntry[Manifest_Size] = iSize;
+    iEntry[Manifest_Time] = iTime;
+    iEntry[Manifest_Used] = iUsed;
+    iEntry[Manifest_List] = hList;
+    trieModelsManifest.SetArray(sPath, iEntry, sizeof(iEntry));
+    
+    // Sets on the changes
+    gModelsManifestChanged = true;
+    return false;
 }
 
 /**
- * Reads the current model and precache its materials.
+ * Removes the manifest entry of the file, the failed builds are not stored.
  *
- * @param sModel            The model path.
- * @return                  True if was precached, false otherwise.
+ * @param sPath             The file path.
  **/
-stock bool ModelsPrecacheMaterials(const char[] sModel)
+void ModelsManifestRemove(const char[] sPath)
 {
-    // Finds the first occurrence of a character in a string
-    int iFormat = FindCharInString(sModel, '.', true);
-    
-    // If model path is don't have format, then log, and stop
-    if(iFormat == -1)
+    // Gets the entry
+    int iEntry[ModelsManifestData];
+    if(trieModelsManifest.GetArray(sPath, iEntry, sizeof(iEntry)))
     {
-        LogEvent(false, LogType_Fatal, LOG_CORE_EVENTS, LogModule_Models, "Config Validation", "Missing file format: %s", sModel);
-        return false;
+        // Remove the entry
+        delete iEntry[Manifest_List];
+        trieModelsManifest.Remove(sPath);
+        
+        // Sets on the changes
+        gModelsManifestChanged = true;
     }
-    
-    // Extract value string
-    static char sPath[PLATFORM_MAX_PATH];
-    StrExtract(sPath, sModel, 0, iFormat);
-
-    // Concatenates one string onto another
-    StrCat(sPath, sizeof(sPath), "_materials.txt");
+}
 
-    // Validate if a file exists
-    bool bExists = FileExists(sPath);
+/**
+ * Removes the manifest entries, which wasn't used for the expire time.
+ **/
+void ModelsManifestPrune(/*void*/)
+{
+    // Initialize variables
+    static char sPath[PLATFORM_MAX_PATH]; int iEntry[ModelsManifestData]; int iExpire = GetTime() - MODELS_MANIFEST_EXPIRE;
     
-    // Open/Create the file
-    File hBase = OpenFile(sPath, "at+");
-
-    // If file doesn't exist, then write it
-    if(!bExists)
+    // Gets the entry keys
+    StringMapSnapshot hSnapshot = trieModelsManifest.Snapshot();
+    
+    // i = entry index
+    int iSize = hSnapshot.Length;
+    for(int i = 0; i < iSize; i++)
     {
-        // Open the file
-        File hFile = OpenFile(sModel, "rb");
-
-        // If doesn't exist stop
-        if(hFile == INVALID_HANDLE)
+        // Gets the entry
+        hSnapshot.GetKey(i, sPath, sizeof(sPath));
+        trieModelsManifest.GetArray(sPath, iEntry, sizeof(iEntry));
+        
+        // Validate usage
+        if(iEntry[Manifest_Used] < iExpire)
         {
-            LogEvent(false, LogType_Fatal, LOG_CORE_EVENTS, LogModule_Models, "Config Validation", "Error opening file: \"%s\"", sModel);
-            return false;
+            ModelsManifestRemove(sPath);
         }
-        
-        // Initialize some variables
-        static char sMaterial[PLATFORM_MAX_PATH]; int iNumMat; int iChar;
+    }
+    
+    // Close snapshot
+    delete hSnapshot;
+}
 
-        // Find the total materials amount
-        hFile.Seek(204, SEEK_SET);
-        hFile.ReadInt32(iNumMat);
-        hFile.Seek(0, SEEK_END);
+/**
+ * Precache the resources of the manifest entry.
+ *
+ * @param hList             The resource list.
+ * @param bSounds           If true, the sounds will be precached too.
+ **/
+void ModelsManifestPrecache(ArrayList hList, const bool bSounds)
+{
+    // Initialize variable, not static, materials are precached recursively
+    char sResource[PLATFORM_MAX_PATH];
+    
+    // i = resource index
+    int iSize = hList.Length;
+    for(int i = 0; i < iSize; i++)
+    {
+        // Gets the resource
+        hList.GetString(i, sResource, sizeof(sResource));
         
-        do /// Reads a single binary char
-        {
-            hFile.Seek(-2, SEEK_CUR);
-            hFile.ReadInt8(iChar);
-        } 
-        while(iChar == 0);
-
-        // Shift the cursor a bit
-        hFile.Seek(1 , SEEK_CUR);
-
-        do /// Reads a single binary char
-        {
-            hFile.Seek(-2, SEEK_CUR);
-            hFile.ReadInt8(iChar);
-        } 
-        while(iChar != 0);
-
-        // Reads a UTF8 or ANSI string from a file
-        int iPosIndex = hFile.Position;
-        hFile.ReadString(sMaterial, sizeof(sMaterial));
-        hFile.Seek(iPosIndex, SEEK_SET);
-        hFile.Seek(-1, SEEK_CUR);
-
-        // i = material index
-        for(int i = 0; i < iNumMat; i++)
+        // Switch type
+        switch(sResource[0])
         {
-            do /// Reads a single binary char
-            {
-                hFile.Seek(-2, SEEK_CUR);
-                hFile.ReadInt8(iChar);
-            } 
-            while(iChar != 0);
-
-            // Reads a UTF8 or ANSI string from a file
-            iPosIndex = hFile.Position;
-            hFile.ReadString(sPath, sizeof(sPath));
-            hFile.Seek(iPosIndex, SEEK_SET);
-            
-            // Validate size
-            if(!strlen(sPath))
-            {
-                continue;
-            }
-
-            // Finds the first occurrence of a character in a string
-            iFormat = FindCharInString(sPath, '\\', true);
-
-            // Validate no format
-            if(iFormat != -1)
+            case MODELS_RESOURCE_SOUND :
             {
-                // Format full path to directory
-                Format(sPath, sizeof(sPath), "materials\\%s", sPath);
-        
-                // Open the directory
-                DirectoryListing hDirectory = OpenDirectory(sPath);
-                
-                // If doesn't exist stop
-                if(hDirectory == INVALID_HANDLE)
-                {
-                    LogEvent(false, LogType_Error, LOG_CORE_EVENTS, LogModule_Models, "Config Validation", "Error opening folder: \"%s\"", sPath);
-                    continue;
-                }
-
-                // Initialize variables
-                static char sFile[PLATFORM_MAX_PATH]; FileType hType;
-                
-                // Search files in the directory
-                while(hDirectory.GetNext(sFile, sizeof(sFile), hType)) 
+                // Validate sounds
+                if(bSounds)
                 {
-                    // Switch type
-                    switch(hType) 
-                    {
-                        case FileType_File :
-                        {
-                            // Finds the first occurrence of a character in a string
-                            iFormat = FindCharInString(sFile, '.', true);
-                    
-                            // Validate format
-                            if(iFormat != -1) 
-                            {
-                                // Validate material format
-                                if(!strcmp(sFile[iFormat], ".vmt", false))
-                                {
-                                    // Format full path to file
-                                    Format(sFile, sizeof(sFile), "%s%s", sPath, sFile);
-                                    
-                                    // Store into the base
-                                    hBase.WriteLine(sFile);
-                                    
-                                    // Precache model textures
-                                    ModelsPrecacheTextures(sFile);
-                                }
-                            }
-                        }
-                        
-                        /*case FileType_Unknown :
-                        {
-                            
-                        }
-                        
-                        case FileType_Directory : 
-                        {
-                            
-                        }*/
-                    }
+                    // Add file to download table
+                    fnPrecacheSoundQuirk(sResource[1]);
                 }
-
-                // Close directory
-                delete hDirectory;
             }
-            else
+            
+            case MODELS_RESOURCE_MATERIAL :
             {
-                // Format full path to file
-                Format(sPath, sizeof(sPath), "materials\\%s%s.vmt", sMaterial, sPath);
-                
-                // Store into the base
-                hBase.WriteLine(sPath);
-                
-                // Precache model textures
-                ModelsPrecacheTextures(sPath);
+                // Precache material textures
+                ModelsPrecacheTextures(sResource[1]);
             }
-        }
-        
-        // Close file
-        delete hFile;
-        ///return true;
-    }
-    else
-    {
-        // Read lines in the file
-        while(hBase.ReadLine(sPath, sizeof(sPath)))
-        {
-            // Cut out comments at the end of a line
-            if(StrContains(sPath, "//") != -1)
+            
+            case MODELS_RESOURCE_SEQUENCES :
             {
-                SplitString(sPath, "//", sPath, sizeof(sPath));
+                /// Read by the weapon HDR module
             }
             
-            // Trim off whitespace
-            TrimString(sPath);
-
-            // If line is empty, then stop
-            if(!strlen(sPath))
+            default :
             {
-                continue;
+                // Add file to download table
+                AddFileToDownloadsTable(sResource[1]);
             }
-            
-            // Precache model textures
-            ModelsPrecacheTextures(sPath);
         }
     }
-    
-    // Close file
-    delete hBase;
-    return true;
 }
 
 /**
- * Reads the current particle and precache its textures.
+ * Gets the sequence swap table from the manifest entry of the model.
  *
  * @param sModel            The model path.
- * @return                  True if was precached, false otherwise.
+ * @param iSequences        The sequence array.
+ * @param iMaxLen           The max length of the array.
+ * @param nSequenceCount    The sequence count.
+ * @return                  True if the table was stored, false otherwise.
  **/
-stock bool ModelsPrecacheParticle(const char[] sModel)
+bool ModelsManifestGetSequences(const char[] sModel, int[] iSequences, const int iMaxLen, int &nSequenceCount)
 {
-    // Finds the first occurrence of a character in a string
-    int iFormat = FindCharInString(sModel, '.', true);
-    
-    // If model path is don't have format, then log, and stop
-    if(iFormat == -1)
+    // Gets the entry, it is validated by the precache of the model
+    int iEntry[ModelsManifestData];
+    if(!trieModelsManifest.GetArray(sModel, iEntry, sizeof(iEntry)))
     {
-        LogEvent(false, LogType_Fatal, LOG_CORE_EVENTS, LogModule_Models, "Config Validation", "Missing file format: %s", sModel);
         return false;
     }
     
-    /// https://github.com/VSES/SourceEngine2007/blob/master/src_main/movieobjects/dmeparticlesystemdefinition.cpp
-    /*static const char sParticleFuncTypes[48][SMALL_LINE_LENGTH] =
-    {
-        "DmeParticleSystemDefinition", "DmElement", "DmeParticleChild", "DmeParticleOperator", "particleSystemDefinitions",
-        "preventNameBasedLookup", "particleSystemDefinitionDict", "snapshot", "untitled", "child", "drag", "delay", "name",
-        "renderers", "operators", "initializers", "emitters", "children", "force", "constraints", "body", "duration", "DEBRIES",
-        "color", "render", "radius", "lifetime", "type", "emit", "distance", "rotation", "speed", "fadeout", "DEBRIS", "size",
-        "material", "function", "tint", "max", "min", "gravity", "scale", "rate", "time", "fade", "length", "definition", "thickness"
-    };*/
-
-    // Add file to download table
-    AddFileToDownloadsTable(sModel);
-
-    // Precache generic
-    PrecacheGeneric(sModel, true); //! Precache only here
-    
-    // Extract value string
-    static char sPath[PLATFORM_MAX_PATH];
-    StrExtract(sPath, sModel, 0, iFormat);
-
-    // Concatenates one string onto another
-    StrCat(sPath, sizeof(sPath), "_particles.txt");
+    // Initialize variables
+    static char sResource[PLATFORM_MAX_PATH]; static char sValue[WeaponsSequencesMax + 1][SMALL_LINE_LENGTH];
+    ArrayList hList = view_as<ArrayList>(iEntry[Manifest_List]);
     
-    // Validate if a file exists
-    bool bExists = FileExists(sPath);
-    
-    // Open/Create the file
-    File hBase = OpenFile(sPath, "at+");
-
-    // If file doesn't exist, then write it
-    if(!bExists)
+    // i = resource index
+    int iSize = hList.Length;
+    for(int i = 0; i < iSize; i++)
     {
-        // Open the file
-        File hFile = OpenFile(sModel, "rb");
-
-        // If doesn't exist stop
-        if(hFile == INVALID_HANDLE)
+        // Gets the resource
+        hList.GetString(i, sResource, sizeof(sResource));
+        
+        // Validate type
+        if(sResource[0] != MODELS_RESOURCE_SEQUENCES)
+        {
+            continue;
+        }
+        
+        // Read the table (count sequences...)
+        int iCount = ExplodeString(sResource[1], " ", sValue, sizeof(sValue), sizeof(sValue[]));
+        nSequenceCount = StringToInt(sValue[0]);
+        
+        // Validate table
+        if(!(0 < nSequenceCount < iMaxLen) || iCount != nSequenceCount + 1)
         {
-            LogEvent(false, LogType_Fatal, LOG_CORE_EVENTS, LogModule_Models, "Config Validation", "Error opening file: \"%s\"", sModel);
             return false;
         }
+        
+        // x = sequence index
+        for(int x = 0; x < nSequenceCount; x++)
+        {
+            iSequences[x] = StringToInt(sValue[x + 1]);
+        }
+        
+        // Return on success
+        return true;
+    }
+    
+    // Table doesn't exist
+    return false;
+}
 
-        // Initialize some variables
-        int iChar; ///int iNumMat;
-
-        do /// Reads a single binary char
+/**
+ * Sets the sequence swap table into the manifest entry of the model.
+ *
+ * @param sModel            The model path.
+ * @param iSequences        The sequence array.
+ * @param nSequenceCount    The sequence count.
+ **/
+void ModelsManifestSetSequences(const char[] sModel, const int[] iSequences, const int nSequenceCount)
+{
+    // Gets the entry, models which wasn't precached by the manifest are skipped
+    int iEntry[ModelsManifestData];
+    if(!trieModelsManifest.GetArray(sModel, iEntry, sizeof(iEntry)))
+    {
+        return;
+    }
+    
+    // Format the table (count sequences...)
+    static char sResource[PLATFORM_MAX_PATH];
+    FormatEx(sResource, sizeof(sResource), "%c%d", MODELS_RESOURCE_SEQUENCES, nSequenceCount);
+    
+    // i = sequence index
+    for(int i = 0; i < nSequenceCount; i++)
+    {
+        Format(sResource, sizeof(sResource), "%s %d", sResource, iSequences[i]);
+    }
+    
+    // i = resource index
+    ArrayList hList = view_as<ArrayList>(iEntry[Manifest_List]);
+    for(int i = hList.Length - 1; i >= 0; i--)
+    {
+        // Remove the previous table
+        if(hList.Get(i, 0, true) == MODELS_RESOURCE_SEQUENCES)
         {
-            hFile.Seek(2, SEEK_CUR);
-            hFile.ReadInt8(iChar);
-        } 
-        while(iChar == 0);
+            hList.Erase(i);
+        }
+    }
+    
+    // Push the table
+    hList.PushString(sResource);
+    
+    // Sets on the changes
+    gModelsManifestChanged = true;
+}
 
-        // Shift the cursor a bit
-        hFile.Seek(1, SEEK_CUR);
+/**
+ * Pushes the resource into the manifest entry.
+ *
+ * @param hList             The resource list.
+ * @param iType             The resource type.
+ * @param sPath             The resource path.
+ **/
+void ModelsManifestPush(ArrayList hList, const int iType, const char[] sPath)
+{
+    // Format the resource
+    static char sResource[PLATFORM_MAX_PATH];
+    FormatEx(sResource, sizeof(sResource), "%c%s", iType, sPath);
+    
+    // Normalize slashes
+    ReplaceString(sResource, sizeof(sResource), "\\", "/");
+    
+    // Validate the reoccurrence
+    if(hList.FindString(sResource) == -1)
+    {
+        // Push the resource
+        hList.PushString(sResource);
+    }
+}
 
-        do /// Reads a single binary char
-        {
-            hFile.Seek(2, SEEK_CUR);
-            hFile.ReadInt8(iChar);
-        } 
-        while(iChar != 0);
+/**
+ * Builds the manifest entry of the model.
+ *
+ * @param sModel            The model path.
+ * @param hList             The resource list.
+ * @return                  True if was built, false otherwise.
+ **/
+bool ModelsManifestBuildModel(const char[] sModel, ArrayList hList)
+{
+    // Initialize some variables
+    static char sResource[PLATFORM_MAX_PATH];
+    static const char sTypes[3][SMALL_LINE_LENGTH] = { ".dx90.vtx", ".phy", ".vvd" };
 
-        // Loop throught the binary
-        while(!hFile.EndOfFile())
+    // Finds the first occurrence of a character in a string
+    int iFormat = FindCharInString(sModel, '.', true);
+    
+    // If model path is don't have format, then log, and stop
+    if(iFormat == -1)
+    {
+        LogEvent(false, LogType_Fatal, LOG_CORE_EVENTS, LogModule_Models, "Config Validation", "Missing file format: %s", sModel);
+        return false;
+    }
+    
+    // i = resource type
+    int iSize = sizeof(sTypes);
+    for(int i = 0; i < iSize; i++)
+    {
+        // Extract value string
+        StrExtract(sResource, sModel, 0, iFormat);
+        
+        // Concatenates one string onto another
+        StrCat(sResource, sizeof(sResource), sTypes[i]);
+        
+        // Validate resource
+        if(FileExists(sResource)) 
         {
-            // Reads a UTF8 or ANSI string from a file
-            hFile.ReadString(sPath, sizeof(sPath));
+            // Store into the entry
+            ModelsManifestPush(hList, MODELS_RESOURCE_FILE, sResource);
+        }
+    }
+    
+    // Open the file
+    File hFile = OpenFile(sModel, "rb");
 
-            // Finds the first occurrence of a character in a string
-            iFormat = FindCharInString(sPath, '.', true);
+    // If doesn't exist stop
+    if(hFile == INVALID_HANDLE)
+    {
+        LogEvent(false, LogType_Fatal, LOG_CORE_EVENTS, LogModule_Models, "Config Validation", "Error opening file: \"%s\"", sModel);
+        return false;
+    }
+    
+    // Store the materials of the studiohdr
+    bool bSuccess = ModelsManifestReadMaterials(hFile, hList, sModel);
+    
+    // Store the sound strings of the binary
+    hFile.Seek(0, SEEK_SET);
+    ModelsManifestScanStrings(hFile, hList, true);
 
-            // Validate format
-            if(iFormat != -1)
+    // Close file
+    delete hFile;
+    return bSuccess;
+}
+
+/**
+ * Reads the materials from the studiohdr of the model.
+ *
+ * @param hFile             The model file.
+ * @param hList             The resource list.
+ * @param sModel            The model path.
+ * @return                  True if the texture tables were read, false otherwise.
+ **/
+bool ModelsManifestReadMaterials(File hFile, ArrayList hList, const char[] sModel)
+{
+    // Read the texture block of the studiohdr (numtextures, textureindex, numcdtextures, cdtextureindex)
+    int iHeader[4];
+    hFile.Seek(204, SEEK_SET);
+    if(hFile.Read(iHeader, sizeof(iHeader), 4) != sizeof(iHeader) || !(0 < iHeader[0] <= MODELS_MANIFEST_TEXTURES) || !(0 < iHeader[2] <= MODELS_MANIFEST_TEXTURES))
+    {
+        LogEvent(false, LogType_Error, LOG_CORE_EVENTS, LogModule_Models, "Config Validation", "Invalid texture header in file: \"%s\"", sModel);
+        return false;
+    }
+    
+    // Read the texture records (mstudiotexture_t is 16 cells)
+    int iNumTex = iHeader[0]; int[] iTexture = new int[iNumTex * 16];
+    hFile.Seek(iHeader[1], SEEK_SET);
+    if(hFile.Read(iTexture, iNumTex * 16, 4) != iNumTex * 16)
+    {
+        LogEvent(false, LogType_Error, LOG_CORE_EVENTS, LogModule_Models, "Config Validation", "Invalid texture records in file: \"%s\"", sModel);
+        return false;
+    }
+    
+    // Read the texture directory offsets
+    int iNumDir = iHeader[2]; int[] iDirectory = new int[iNumDir];
+    hFile.Seek(iHeader[3], SEEK_SET);
+    if(hFile.Read(iDirectory, iNumDir, 4) != iNumDir)
+    {
+        LogEvent(false, LogType_Error, LOG_CORE_EVENTS, LogModule_Models, "Config Validation", "Invalid texture directories in file: \"%s\"", sModel);
+        return false;
+    }
+    
+    // Initialize variables
+    static char sName[PLATFORM_MAX_PATH]; static char sDirectory[PLATFORM_MAX_PATH]; static char sMaterial[PLATFORM_MAX_PATH];
+    
+    // i = texture index
+    for(int i = 0; i < iNumTex; i++)
+    {
+        // Reads the texture name (sznameindex is relative to the record)
+        hFile.Seek(iHeader[1] + i * 64 + iTexture[i * 16], SEEK_SET);
+        hFile.ReadString(sName, sizeof(sName));
+        
+        // Validate size
+        if(!strlen(sName))
+        {
+            continue;
+        }
+        
+        // x = directory index
+        bool bFound;
+        for(int x = 0; x < iNumDir; x++)
+        {
+            // Reads the directory
+            hFile.Seek(iDirectory[x], SEEK_SET);
+            hFile.ReadString(sDirectory, sizeof(sDirectory));
+            
+            // Format full path to file
+            FormatEx(sMaterial, sizeof(sMaterial), "materials/%s%s.vmt", sDirectory, sName);
+            ReplaceString(sMaterial, sizeof(sMaterial), "\\", "/");
+            
+            // Validate material
+            if(FileExists(sMaterial))
             {
-                // Validate material format
-                if(!strcmp(sPath[iFormat], ".vmt", false))
-                {
-                    // Format full path to file
-                    Format(sPath, sizeof(sPath), "materials\\%s", sPath);
-                    
-                    // Store into the base
-                    hBase.WriteLine(sPath);
-                    
-                    // Precache model textures
-                    ModelsPrecacheTextures(sPath);
-                }
+                // Store into the entry
+                ModelsManifestPush(hList, MODELS_RESOURCE_MATERIAL, sMaterial);
+                bFound = true;
+                break;
             }
         }
+        
+        // Validate material
+        if(!bFound)
+        {
+            LogEvent(false, LogType_Error, LOG_CORE_EVENTS, LogModule_Models, "Config Validation", "Invalid material \"%s\" in file: \"%s\"", sName, sModel);
+        }
+    }
+    
+    // x = directory index
+    for(int x = 0; x < iNumDir; x++)
+    {
+        // Reads the directory
+        hFile.Seek(iDirectory[x], SEEK_SET);
+        hFile.ReadString(sDirectory, sizeof(sDirectory));
+        
+        // Validate size
+        if(!strlen(sDirectory))
+        {
+            continue;
+        }
+        
+        // Format full path to directory
+        FormatEx(sMaterial, sizeof(sMaterial), "materials/%s", sDirectory);
+        ReplaceString(sMaterial, sizeof(sMaterial), "\\", "/");
+        
+        // Validate the trailing slash
+        if(sMaterial[strlen(sMaterial) - 1] != '/')
+        {
+            StrCat(sMaterial, sizeof(sMaterial), "/");
+        }
+        
+        // Store all materials of the directory, skins and proxies may use materials outside of the texture table
+        ModelsManifestReadDirectory(hList, sMaterial);
+    }
+    
+    // Return on success
+    return true;
+}
 
-        // Close file
-        delete hFile;
-        ///return true;
+/**
+ * Stores all materials of the directory into the manifest entry.
+ *
+ * @param hList             The resource list.
+ * @param sPath             The directory path.
+ **/
+void ModelsManifestReadDirectory(ArrayList hList, const char[] sPath)
+{
+    // Open the directory
+    DirectoryListing hDirectory = OpenDirectory(sPath);
+    
+    // If doesn't exist stop
+    if(hDirectory == INVALID_HANDLE)
+    {
+        LogEvent(false, LogType_Error, LOG_CORE_EVENTS, LogModule_Models, "Config Validation", "Error opening folder: \"%s\"", sPath);
+        return;
     }
-    else
+
+    // Initialize variables
+    static char sFile[PLATFORM_MAX_PATH]; FileType hType;
+    
+    // Search files in the directory
+    while(hDirectory.GetNext(sFile, sizeof(sFile), hType)) 
     {
-        // Read lines in the file
-        while(hBase.ReadLine(sPath, sizeof(sPath)))
+        // Validate file
+        if(hType != FileType_File)
         {
-            // Cut out comments at the end of a line
-            if(StrContains(sPath, "//") != -1)
-            {
-                SplitString(sPath, "//", sPath, sizeof(sPath));
-            }
+            continue;
+        }
         
-            // Trim off whitespace
-            TrimString(sPath);
+        // Finds the first occurrence of a character in a string
+        int iFormat = FindCharInString(sFile, '.', true);
+        
+        // Validate material format
+        if(iFormat != -1 && !strcmp(sFile[iFormat], ".vmt", false))
+        {
+            // Format full path to file
+            Format(sFile, sizeof(sFile), "%s%s", sPath, sFile);
+            
+            // Store into the entry
+            ModelsManifestPush(hList, MODELS_RESOURCE_MATERIAL, sFile);
+        }
+    }
+
+    // Close directory
+    delete hDirectory;
+}
 
-            // If line is empty, then stop
-            if(!strlen(sPath))
+/**
+ * Scans the binary file for the resource strings by the block reads.
+ *
+ * @param hFile             The binary file.
+ * @param hList             The resource list.
+ * @param bSounds           If true, sounds will be stored, materials otherwise.
+ **/
+void ModelsManifestScanStrings(File hFile, ArrayList hList, const bool bSounds)
+{
+    // Initialize some variables
+    static int iBlock[MODELS_MANIFEST_BLOCK]; static char sString[PLATFORM_MAX_PATH]; int iLength; int iRead;
+    
+    // Read the binary by blocks
+    while((iRead = hFile.Read(iBlock, sizeof(iBlock), 1)) > 0)
+    {
+        // i = byte index
+        for(int i = 0; i < iRead; i++)
+        {
+            // Validate printable char
+            if(32 <= iBlock[i] < 127)
             {
+                // Append the char
+                if(iLength < sizeof(sString) - 1)
+                {
+                    sString[iLength++] = iBlock[i];
+                }
                 continue;
             }
             
-            // Finds the first occurrence of a character in a string
-            iFormat = FindCharInString(sPath, '.', true);
-
-            // Validate format
-            if(iFormat != -1)
+            // Validate string
+            if(iLength)
             {
-                // Precache model textures
-                ModelsPrecacheTextures(sPath);
+                // Terminate the string
+                sString[iLength] = '\0'; iLength = 0;
+                
+                // Store the resource
+                ModelsManifestPushString(hList, sString, bSounds);
             }
         }
     }
     
-    // Close file
-    delete hBase;
-    return true;
+    // Validate the last string
+    if(iLength)
+    {
+        // Terminate the string
+        sString[iLength] = '\0';
+        
+        // Store the resource
+        ModelsManifestPushString(hList, sString, bSounds);
+    }
 }
 
 /**
- * Reads the current material and precache its textures.
+ * Stores the string from the binary, if it is a resource.
  *
- * @param sPath             The texture path.
- * @param bDecal            (Optional) If true, the texture will be precached like a decal.
- * @return                  True if was precached, false otherwise.
+ * @param hList             The resource list.
+ * @param sString           The binary string.
+ * @param bSounds           If true, sounds will be stored, materials otherwise.
  **/
-stock bool ModelsPrecacheTextures(const char[] sPath)
+void ModelsManifestPushString(ArrayList hList, const char[] sString, const bool bSounds)
 {
-    // Extract value string
-    static char sTexture[PLATFORM_MAX_PATH];
-    StrExtract(sTexture, sPath, 0, PLATFORM_MAX_PATH);
+    // Finds the first occurrence of a character in a string
+    int iFormat = FindCharInString(sString, '.', true);
 
-    // If doesn't exist stop
-    if(!FileExists(sTexture))
+    // Validate format
+    if(iFormat == -1)
     {
-        LogEvent(false, LogType_Error, LOG_CORE_EVENTS, LogModule_Models, "Config Validation", "Invalid material path. File not found: \"%s\"", sTexture);
-        return false;
+        return;
     }
-
-    // Add file to download table
-    AddFileToDownloadsTable(sTexture);
     
-    // Initialize some variables
-    static const char sTypes[4][SMALL_LINE_LENGTH] = { "$baseTexture", "$bumpmap", "$lightwarptexture", "$REFRACTTINTtexture" }; bool bFound[sizeof(sTypes)]; static int iShift;
+    // Initialize variable
+    static char sPath[PLATFORM_MAX_PATH];
     
+    // Validate sound format
+    if(bSounds)
+    {
+        if(!strcmp(sString[iFormat], ".mp3", false) || !strcmp(sString[iFormat], ".wav", false))
+        {
+            // Format full path to file
+            FormatEx(sPath, sizeof(sPath), "sound/%s", sString);
+            
+            // Store into the entry
+            ModelsManifestPush(hList, MODELS_RESOURCE_SOUND, sPath);
+        }
+    }
+    // Validate material format
+    else if(!strcmp(sString[iFormat], ".vmt", false))
+    {
+        // Format full path to file
+        FormatEx(sPath, sizeof(sPath), "materials/%s", sString);
+        
+        // Store into the entry
+        ModelsManifestPush(hList, MODELS_RESOURCE_MATERIAL, sPath);
+    }
+}
+
+/**
+ * Builds the manifest entry of the material.
+ *
+ * @param sPath             The material path.
+ * @param hList             The resource list.
+ * @return                  True if was built, false otherwise.
+ **/
+bool ModelsManifestBuildMaterial(const char[] sPath, ArrayList hList)
+{
     // Open the file
-    File hFile = OpenFile(sTexture, "rt");
+    File hFile = OpenFile(sPath, "rt");
     
     // If doesn't exist stop
     if(hFile == INVALID_HANDLE)
     {
-        LogEvent(false, LogType_Fatal, LOG_CORE_EVENTS, LogModule_Models, "Config Validation", "Error opening file: \"%s\"", sTexture);
+        LogEvent(false, LogType_Fatal, LOG_CORE_EVENTS, LogModule_Models, "Config Validation", "Error opening file: \"%s\"", sPath);
+        return false;
     }
     
+    // Initialize some variables
+    static char sTexture[PLATFORM_MAX_PATH];
+    static const char sTypes[4][SMALL_LINE_LENGTH] = { "$baseTexture", "$bumpmap", "$lightwarptexture", "$REFRACTTINTtexture" }; bool bFound[sizeof(sTypes)]; static int iShift;
+    
     // Read lines in the file
     while(hFile.ReadLine(sTexture, sizeof(sTexture)))
     {
@@ -740,20 +998,21 @@ stock bool ModelsPrecacheTextures(const char[] sPath)
                     // Extract value string
                     StrExtract(sTexture, sTexture[iShift], iQuote2 + 1, iQuote1);
                     
-                    // Format full path to file
-                    Format(sTexture, sizeof(sTexture), "materials\\%s.vtf", sTexture);
-                    
                     // Validate size
                     if(!strlen(sTexture))
                     {
                         continue;
                     }
                     
-                    // Validate material
+                    // Format full path to file
+                    Format(sTexture, sizeof(sTexture), "materials/%s.vtf", sTexture);
+                    ReplaceString(sTexture, sizeof(sTexture), "\\", "/");
+                    
+                    // Validate texture
                     if(FileExists(sTexture))
                     {
-                        // Add file to download table
-                        AddFileToDownloadsTable(sTexture);
+                        // Store into the entry
+                        ModelsManifestPush(hList, MODELS_RESOURCE_FILE, sTexture);
                     }
                     else
                     {
@@ -769,6 +1028,133 @@ stock bool ModelsPrecacheTextures(const char[] sPath)
     return true;
 }
 
+/**
+ * Reads the manifest file into the trie.
+ **/
+void ModelsManifestRead(/*void*/)
+{
+    // Build full path in return string
+    static char sPath[PLATFORM_MAX_PATH];
+    BuildPath(Path_SM, sPath, sizeof(sPath), MODELS_MANIFEST_PATH);
+    
+    // Open the file
+    File hBase = OpenFile(sPath, "rt");
+    
+    // If doesn't exist stop
+    if(hBase == INVALID_HANDLE)
+    {
+        return;
+    }
+    
+    // Initialize variables
+    static char sLine[PLATFORM_MAX_PATH]; static char sValue[5][PLATFORM_MAX_PATH]; int iEntry[ModelsManifestData];
+    
+    // Read the headers (path|size|time|count|used), the usage time is missing in the old manifests
+    while(hBase.ReadLine(sLine, sizeof(sLine)))
+    {
+        // Trim off whitespace
+        TrimString(sLine);
+        
+        // Validate header
+        int iFields = ExplodeString(sLine, "|", sValue, sizeof(sValue), sizeof(sValue[]));
+        if(iFields != 4 && iFields != 5)
+        {
+            continue;
+        }
+        
+        // Initialize the list
+        ArrayList hList = CreateArray(ByteCountToCells(PLATFORM_MAX_PATH));
+        
+        // i = resource index
+        int iCount = StringToInt(sValue[3]);
+        for(int i = 0; i < iCount; i++)
+        {
+            // Read line
+            if(!hBase.ReadLine(sLine, sizeof(sLine)))
+            {
+                break;
+            }
+            
+            // Trim off whitespace
+            TrimString(sLine);
+            
+            // Push the resource
+            hList.PushString(sLine);
+        }
+        
+        // Replace the duplicate entry
+        if(trieModelsManifest.GetArray(sValue[0], iEntry, sizeof(iEntry)))
+        {
+            delete iEntry[Manifest_List];
+        }
+        
+        // Store the entry
+        iEntry[Manifest_Size] = StringToInt(sValue[1]);
+        iEntry[Manifest_Time] = StringToInt(sValue[2]);
+        iEntry[Manifest_Used] = (iFields == 5) ? StringToInt(sValue[4]) : GetTime();
+        iEntry[Manifest_List] = hList;
+        trieModelsManifest.SetArray(sValue[0], iEntry, sizeof(iEntry));
+    }
+    
+    // Close file
+    delete hBase;
+}
+
+/**
+ * Writes the manifest file from the trie.
+ **/
+void ModelsManifestWrite(/*void*/)
+{
+    // Build full path in return string
+    static char sPath[PLATFORM_MAX_PATH];
+    BuildPath(Path_SM, sPath, sizeof(sPath), MODELS_MANIFEST_PATH);
+    
+    // Create the file
+    File hBase = OpenFile(sPath, "wt");
+    
+    // If doesn't exist stop
+    if(hBase == INVALID_HANDLE)
+    {
+        LogEvent(false, LogType_Error, LOG_CORE_EVENTS, LogModule_Models, "Config Validation", "Error opening file: \"%s\"", sPath);
+        return;
+    }
+    
+    // Initialize variables
+    static char sResource[PLATFORM_MAX_PATH]; int iEntry[ModelsManifestData];
+    
+    // Gets the entry keys
+    StringMapSnapshot hSnapshot = trieModelsManifest.Snapshot();
+    
+    // i = entry index
+    int iSize = hSnapshot.Length;
+    for(int i = 0; i < iSize; i++)
+    {
+        // Gets the entry
+        hSnapshot.GetKey(i, sPath, sizeof(sPath));
+        trieModelsManifest.GetArray(sPath, iEntry, sizeof(iEntry));
+        ArrayList hList = view_as<ArrayList>(iEntry[Manifest_List]);
+        
+        // Write the header
+        int iCount = hList.Length;
+        hBase.WriteLine("%s|%d|%d|%d|%d", sPath, iEntry[Manifest_Size], iEntry[Manifest_Time], iCount, iEntry[Manifest_Used]);
+        
+        // x = resource index
+        for(int x = 0; x < iCount; x++)
+        {
+            // Write the resource
+            hList.GetString(x, sResource, sizeof(sResource));
+            hBase.WriteLine("%s", sResource);
+        }
+    }
+    
+    // Close handles
+    delete hSnapshot;
+    delete hBase;
+    
+    // Resets the changes
+    gModelsManifestChanged = false;
+}
+
 /**
  * Validates the specified standart models.
  *
@@ -25,11 +25,32 @@
  * ============================================================================
  **/
 
+/**
+ * Number of cells in the client bitset.
+ **/
+#define VOICE_BLOCKS ((MAXPLAYERS + 1) / 32 + 1)
+
 /**
  * Updates every round with the value of the cvar.
  **/
 bool g_bVoice;
 
+/**
+ * True if everyone is allowed to listen/speak with each other. (Round end)
+ **/
+bool gVoiceAllTalk;
+
+/**
+ * True if the flush of the override matrix is requested.
+ **/
+bool gVoicePending;
+
+/**
+ * Applied override matrix. (receiver -> bitset of senders)
+ **/
+int gVoiceListenYes[MAXPLAYERS+1][VOICE_BLOCKS];
+int gVoiceListenNo[MAXPLAYERS+1][VOICE_BLOCKS];
+
 /**
  * The round is starting.
  **/
@@ -37,14 +58,22 @@ void VoiceOnRoundStart(/*void*/)
 {
     bool bVoice = gCvarList[CVAR_SEFFECTS_VOICE].BoolValue;
     
-    // If the cvar has changed, then reset the voice permissions
-    if(g_bVoice != bVoice)
+    // If the cvar has changed or the round end talk was enabled, then reset the voice flags
+    if(g_bVoice != bVoice || gVoiceAllTalk)
     {
         VoiceReset();
     }
     
     // Update cvar with new value
     g_bVoice = bVoice;
+    gVoiceAllTalk = false;
+    
+    // Validate module
+    if(g_bVoice)
+    {
+        // Update the matrix
+        VoiceRequestFlush();
+    }
 }
 
 /**
@@ -85,25 +114,30 @@ void VoiceOnClientHumanized(const int clientIndex)
 }
 
 /**
- * Set the receiver ability to listen to the sender.
- *
- * @note  This function is from sdktools_voice, it fails if iSender is muted.
- *
- * @param iReceiver         The listener index.
- * @param iSender           The sender index.
- * @return                  True if successful otherwise false.
+ * Client has been disconnected.
+ * 
+ * @param clientIndex       The client index.
  **/
-stock bool VoiceSetClientListening(const int iReceiver, const int iSender, const bool bListen)
+void VoiceOnClientDisconnect(const int clientIndex)
 {
-    // If the sender is muted, then return false
-    if(VoiceIsClientMuted(iSender))
+    // Gets the client bit
+    int iBlock = clientIndex / 32; int iBit = (1 << (clientIndex % 32));
+    
+    // i = client index
+    for(int i = 1; i <= MaxClients; i++)
     {
-        return false;
+        // Clear the column, sdktools resets overrides of the slot
+        gVoiceListenYes[i][iBlock] &= ~iBit;
+        gVoiceListenNo[i][iBlock] &= ~iBit;
     }
     
-    // Sets the overide
-    ListenOverride override = bListen ? Listen_Yes : Listen_No;
-    return SetListenOverride(iReceiver, iSender, override);
+    // x = block index
+    for(int x = 0; x < VOICE_BLOCKS; x++)
+    {
+        // Clear the row
+        gVoiceListenYes[clientIndex][x] = 0;
+        gVoiceListenNo[clientIndex][x] = 0;
+    }
 }
 
 /**
@@ -111,32 +145,58 @@ stock bool VoiceSetClientListening(const int iReceiver, const int iSender, const
  **/
 stock void VoiceAllTalk(/*void*/)
 {
-    // i = receiver index
+    // Sets the global talk
+    gVoiceAllTalk = true;
+    
+    // i = client index
     for(int i = 1; i <= MaxClients; i++)
     {
-        // If receiver isn't in-game, then stop
+        // If client isn't in-game, then stop
         if(!IsPlayerExist(i, false))
         {
             continue;
         }
         
-        // x = sender index
-        for(int x = 1; x <= MaxClients; x++)
+        // Apply new voice flags, muted clients are still muted
+        SetClientListeningFlags(i, (GetClientListeningFlags(i) & VOICE_MUTED) | VOICE_SPEAKALL | VOICE_LISTENALL);
+    }
+    
+    // Remove the team overrides, the round start flush restores them
+    VoiceClearOverrides();
+}
+
+/**
+ * Resets the applied overrides of the matrix back to default.
+ **/
+stock void VoiceClearOverrides(/*void*/)
+{
+    // i = receiver index
+    for(int i = 1; i <= MaxClients; i++)
+    {
+        // x = block index
+        for(int x = 0; x < VOICE_BLOCKS; x++)
         {
-            // If sender isn't in-game, then stop
-            if(!IsPlayerExist(x, false))
-            {
-                continue;
-            }
+            // Gets the applied cells
+            int iApplied = gVoiceListenYes[i][x] | gVoiceListenNo[i][x];
             
-            // No need to alter listening/speaking flags between one client
-            if(i == x)
+            // y = bit index
+            for(int y = 0; y < 32 && iApplied; y++)
             {
-                continue;
+                // Validate cell
+                int iBit = (1 << y);
+                if(!(iApplied & iBit))
+                {
+                    continue;
+                }
+                
+                // Resets the overide
+                SetListenOverride(i, x * 32 + y, Listen_Default);
+                iApplied &= ~iBit;
             }
             
-            // Receiver (i) can now hear the sender (x), only if sender isn't muted
-            VoiceSetClientListening(i, x, true);
+            // Clear the row
+            gVoiceListenYes[i][x] = 0;
+            gVoiceListenNo[i][x] = 0;
         }
     }
 }
@@ -157,27 +217,106 @@ stock void VoiceSetClientTeam(const int clientIndex, const bool bInfected)
         SetClientListeningFlags(clientIndex, bInfected ? VOICE_MUTED : VOICE_NORMAL);
     }
     
+    // Update the matrix, the team is read on the flush
+    VoiceRequestFlush();
+}
+
+/**
+ * Request the flush of the override matrix on the next frame.
+ **/
+stock void VoiceRequestFlush(/*void*/)
+{
+    // Validate request
+    if(!gVoicePending)
+    {
+        // Sets the request
+        gVoicePending = true;
+        
+        // Flush on the next frame, mass infections are applied once
+        RequestFrame(view_as<RequestFrameCallback>(VoiceOnFlush));
+    }
+}
+
+/**
+ * Applies the cells of the desired override matrix, which differ from the current one.
+ **/
+public void VoiceOnFlush(/*void*/)
+{
+    // Resets the request
+    gVoicePending = false;
+    
+    // If voice module is disabled or the round end talk is enabled, then stop
+    if(!g_bVoice || gVoiceAllTalk)
+    {
+        return;
+    }
+    
+    // Initialize the team bitsets
+    int iPlayers[VOICE_BLOCKS]; int iZombies[VOICE_BLOCKS]; int iMuted[VOICE_BLOCKS];
+    
     // i = client index
     for(int i = 1; i <= MaxClients; i++)
     {
-        // If sender isn't in-game, then stop.
+        // If client isn't in-game, then stop
         if(!IsPlayerExist(i, false))
         {
             continue;
         }
         
-        // No need to alter listening/speaking flags between one client
-        if(clientIndex == i)
+        // Gets the client bit
+        int iBlock = i / 32; int iBit = (1 << (i % 32));
+        
+        // Store client into the bitsets
+        iPlayers[iBlock] |= iBit;
+        if(gClientData[i][Client_Zombie]) iZombies[iBlock] |= iBit;
+        if(VoiceIsClientMuted(i)) iMuted[iBlock] |= iBit; /// Overrides of the muted senders aren't touched
+    }
+    
+    // i = receiver index
+    for(int i = 1; i <= MaxClients; i++)
+    {
+        // If receiver isn't in-game, then stop
+        if(!(iPlayers[i / 32] & (1 << (i % 32))))
         {
             continue;
         }
         
-        // Client can only listen/speak if the sender is on their team
-        bool bCanListen = (bInfected == gClientData[i][Client_Zombie]);
-        
-        // (Dis)allow clients to listen/speak with each other, don't touch if the sender is muted
-        VoiceSetClientListening(clientIndex, i, bCanListen);
-        VoiceSetClientListening(i, clientIndex, bCanListen);
+        // x = block index
+        for(int x = 0; x < VOICE_BLOCKS; x++)
+        {
+            // Client can only listen/speak if the sender is on their team
+            int iYes = gClientData[i][Client_Zombie] ? iZombies[x] : (iPlayers[x] & ~iZombies[x]);
+            int iNo = iPlayers[x] & ~iYes;
+            
+            // No need to alter listening/speaking flags between one client
+            if(x == i / 32)
+            {
+                iYes &= ~(1 << (i % 32));
+                iNo &= ~(1 << (i % 32));
+            }
+            
+            // Gets the changed cells
+            int iChanged = ((iYes ^ gVoiceListenYes[i][x]) | (iNo ^ gVoiceListenNo[i][x])) & ~iMuted[x];
+            
+            // y = bit index
+            for(int y = 0; y < 32 && iChanged; y++)
+            {
+                // Validate cell
+                int iBit = (1 << y);
+                if(!(iChanged & iBit))
+                {
+                    continue;
+                }
+                
+                // Sets the overide
+                SetListenOverride(i, x * 32 + y, (iYes & iBit) ? Listen_Yes : (iNo & iBit) ? Listen_No : Listen_Default);
+                iChanged &= ~iBit;
+            }
+            
+            // Store the applied row, except the muted senders
+            gVoiceListenYes[i][x] = (gVoiceListenYes[i][x] & iMuted[x]) | (iYes & ~iMuted[x]);
+            gVoiceListenNo[i][x] = (gVoiceListenNo[i][x] & iMuted[x]) | (iNo & ~iMuted[x]);
+        }
     }
 }
 
@@ -231,7 +370,7 @@ stock void VoiceReset(/*void*/)
             continue;
         }
         
-        // Apply new voice flags
-        SetClientListeningFlags(i, iVoiceFlags);
+        // Apply new voice flags, muted clients are still muted
+        SetClientListeningFlags(i, (GetClientListeningFlags(i) & VOICE_MUTED) | iVoiceFlags);
     }
 }
\ No newline at end of file
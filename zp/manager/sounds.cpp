@@ -52,7 +52,7 @@ int SoundBuffer[SoundBlocksMax][ParamParseResult];
 void SoundsInit(/*void*/)
 {
     // Hooks server sounds
-    AddNormalSoundHook(view_as<NormalSHook>(PlayerSoundsNormalHook));
+    AddNormalSoundHook(view_as<NormalSHook>(DebugOnNormalSound));
 }
 
 /**
@@ -78,7 +78,8 @@ void SoundsLoad(/*void*/)
     ConfigSetConfigPath(File_Sounds, sSoundsPath);
 
     // Load config from file and create array structure
-    bool bSuccess = ConfigLoadConfig(File_Sounds, arraySounds, PLATFORM_MAX_PATH);
+    bool bCached;
+    bool bSuccess = ConfigLoadConfig(File_Sounds, arraySounds, PLATFORM_MAX_PATH, bCached);
 
     // Unexpected error, stop plugin
     if(!bSuccess)
@@ -101,9 +102,35 @@ void SoundsLoad(/*void*/)
         LogEvent(false, LogType_Fatal, LOG_CORE_EVENTS, LogModule_Sounds, "Config Validation", "No usable data found in sounds config file: \"%s\"", sSoundsPath);
     }
     
+    // Weapons store the sound indexes, so they are parsed again with the sounds
+    if(!bCached)
+    {
+        ConfigClearConfigStamp(File_Weapons);
+    }
+    
     // i = sound array index
     for(int i = 0; i < iSounds; i++)
     {
+        // If the data was kept, then only precache the sounds
+        if(bCached)
+        {
+            // Gets array size
+            ArrayList arraySound = arraySounds.Get(i);
+            int iSize = arraySound.Length;
+            
+            // x = sound index
+            for(int x = 1; x < iSize; x++)
+            {
+                // Format the full path
+                arraySound.GetString(x, sSoundsPath, sizeof(sSoundsPath));
+                Format(sSoundsPath, sizeof(sSoundsPath), "sound/%s", sSoundsPath);
+                
+                // Add to server precache list
+                if(DownloadsOnPrecache(sSoundsPath)) iSoundValidCount++; else iSoundUnValidCount++;
+            }
+            continue;
+        }
+        
         // Gets array line
         sSoundsPath[0] = '\0'; SoundsGetLine(i, sSoundsPath, sizeof(sSoundsPath));
 
@@ -200,6 +227,17 @@ void SoundsOnRoundEnd(const int CReason)
     CreateTimer(0.1, PlayerSoundsOnRoundEnd, CReason, TIMER_FLAG_NO_MAPCHANGE); /// (Bug fix)
 }
 
+/**
+ * Client has been disconnected.
+ * 
+ * @param clientIndex       The client index.
+ **/
+void SoundsOnClientDisconnect(const int clientIndex)
+{
+    // Forward event to sub-modules
+    VoiceOnClientDisconnect(clientIndex);
+}
+
 /**
  * Client has been killed.
  * 
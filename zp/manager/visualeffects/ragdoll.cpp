@@ -34,10 +34,81 @@
 #define VEFFECTS_RAGDOLL_DISSOLVE_ELECTRICALH   1
 #define VEFFECTS_RAGDOLL_DISSOLVE_ELECTRICALL   2
 #define VEFFECTS_RAGDOLL_DISSOLVE_CORE          3
+#define VEFFECTS_RAGDOLL_DISSOLVE_MAX           4
 /**
  * @endsection
  **/
 
+/**
+ * Time window, in which the due ragdolls are dissolved together.
+ **/
+#define VEFFECTS_RAGDOLL_BATCH_WINDOW           0.1
+
+/**
+ * Ragdoll queue data block.
+ **/
+enum RagdollQueueData
+{
+    Ragdoll_Ref,
+    Float:Ragdoll_Time
+}
+
+/**
+ * Array to store the ragdolls, which are sorted by the remove time.
+ **/
+ArrayList arrayRagdollQueue;
+
+/**
+ * Timer of the queue head.
+ **/
+Handle hRagdollTimer = INVALID_HANDLE;
+
+/**
+ * Array to store the shared dissolvers of each dissolve type.
+ **/
+int gRagdollDissolver[VEFFECTS_RAGDOLL_DISSOLVE_MAX] = { INVALID_ENT_REFERENCE, ... };
+
+/**
+ * Initialize the ragdoll queue.
+ **/
+void RagdollInit(/*void*/)
+{
+    // Initialize the array of blocks
+    arrayRagdollQueue = CreateArray(view_as<int>(RagdollQueueData));
+}
+
+/**
+ * Purge the ragdoll queue on the map end.
+ **/
+void RagdollPurge(/*void*/)
+{
+    // Purge the timer
+    hRagdollTimer = INVALID_HANDLE; /// with flag TIMER_FLAG_NO_MAPCHANGE
+
+    // Clear the queue
+    arrayRagdollQueue.Clear();
+    
+    // i = dissolve type
+    for(int i = 0; i < VEFFECTS_RAGDOLL_DISSOLVE_MAX; i++)
+    {
+        // Clear the dissolver, entities are removed by the map change
+        gRagdollDissolver[i] = INVALID_ENT_REFERENCE;
+    }
+}
+
+/**
+ * Create the shared dissolvers on the map start.
+ **/
+void RagdollLoad(/*void*/)
+{
+    // i = dissolve type
+    for(int i = 0; i < VEFFECTS_RAGDOLL_DISSOLVE_MAX; i++)
+    {
+        // Create the dissolver
+        RagdollGetDissolver(i);
+    }
+}
+
 /**
  * Client has been killed.
  * 
@@ -63,34 +134,163 @@ void RagdollOnClientDeath(const int clientIndex)
         return;
     }
 
-    // If the delay is zero, then remove right now
+    // Push the ragdoll to the queue
     float flDissolveDelay = gCvarList[CVAR_VEFFECTS_RAGDOLL_DELAY].FloatValue;
+    RagdollQueueInsert(EntIndexToEntRef(iRagdoll), GetGameTime() + flDissolveDelay);
+
+    // If the delay is zero, then remove right now
     if(!flDissolveDelay)
     {
-        RagdollTimer(INVALID_HANDLE, iRagdoll);
+        RagdollOnQueueTimer(INVALID_HANDLE);
+    }
+}
+
+/**
+ * Insert the ragdoll to the queue sorted by the remove time.
+ *
+ * @param referenceIndex    The reference index.
+ * @param flTime            The remove time.
+ **/
+void RagdollQueueInsert(const int referenceIndex, const float flTime)
+{
+    // Initialize the block
+    int iQueue[RagdollQueueData];
+    iQueue[Ragdoll_Ref] = referenceIndex;
+    iQueue[Ragdoll_Time] = flTime;
+
+    // i = block index, the delay is the same mostly, so search from the tail
+    int iIndex = arrayRagdollQueue.Length;
+    while(iIndex > 0 && view_as<float>(arrayRagdollQueue.Get(iIndex - 1, view_as<int>(Ragdoll_Time))) > flTime)
+    {
+        iIndex--;
+    }
+
+    // Validate the tail
+    if(iIndex == arrayRagdollQueue.Length)
+    {
+        // Push the block
+        arrayRagdollQueue.PushArray(iQueue, sizeof(iQueue));
+    }
+    else
+    {
+        // Insert the block
+        arrayRagdollQueue.ShiftUp(iIndex);
+        arrayRagdollQueue.SetArray(iIndex, iQueue, sizeof(iQueue));
+    }
+
+    // Update the schedule, if a new head
+    if(!iIndex)
+    {
+        RagdollQueueSchedule();
+    }
+}
+
+/**
+ * Schedule the drain of the queue by the remove time of the head.
+ **/
+void RagdollQueueSchedule(/*void*/)
+{
+    // Delete the previous timer
+    delete hRagdollTimer;
+
+    // Validate queue
+    if(!arrayRagdollQueue.Length)
+    {
         return;
     }
 
-    // Create a timer to remove/dissolve ragdoll
-    CreateTimer(flDissolveDelay, RagdollTimer, EntIndexToEntRef(iRagdoll), TIMER_FLAG_NO_MAPCHANGE);
+    // Gets the delay of the head
+    float flDelay = view_as<float>(arrayRagdollQueue.Get(0, view_as<int>(Ragdoll_Time))) - GetGameTime();
+
+    // Sets timer for the head, timers have the resolution of 0.1 second
+    hRagdollTimer = CreateTimer((flDelay < 0.1) ? 0.1 : flDelay, RagdollOnQueueTimer, _, TIMER_FLAG_NO_MAPCHANGE);
 }
 
 /**
- * Removed a ragdoll from the game following plugin settings.
+ * Timer callback. Removed the due ragdolls.
  * 
- * @param iRagdoll          The ragdoll index.
+ * @param hTimer            The timer handle. 
  **/
-void RagdollRemove(const int iRagdoll)
+public Action RagdollOnQueueTimer(Handle hTimer)
 {
+    // Clear timer, if it is a callback
+    if(hTimer != INVALID_HANDLE)
+    {
+        hRagdollTimer = INVALID_HANDLE;
+    }
+
     // Gets the dissolve type
     int iRagDollType = gCvarList[CVAR_VEFFECTS_RAGDOLL_DISSOLVE].IntValue;
 
+    // Validate the type, any unknown value is a random effect
+    if(iRagDollType < VEFFECTS_RAGDOLL_DISSOLVE_EFFECTLESS || iRagDollType > VEFFECTS_RAGDOLL_DISSOLVE_CORE)
+    {
+        iRagDollType = VEFFECTS_RAGDOLL_DISSOLVE_RANDOM;
+    }
+
+    // Initialize the batch of types
+    bool bDissolve[VEFFECTS_RAGDOLL_DISSOLVE_MAX];
+    float flTime = GetGameTime() + VEFFECTS_RAGDOLL_BATCH_WINDOW;
+
+    // Drain all due ragdolls
+    while(arrayRagdollQueue.Length && view_as<float>(arrayRagdollQueue.Get(0, view_as<int>(Ragdoll_Time))) <= flTime)
+    {
+        // Get the ragdoll index from the reference, it is invalid if the edict was reused
+        int iRagdoll = EntRefToEntIndex(arrayRagdollQueue.Get(0, view_as<int>(Ragdoll_Ref)));
+
+        // Remove the block
+        arrayRagdollQueue.Erase(0);
+
+        // If the ragdoll is already gone, then skip
+        if(iRagdoll == INVALID_ENT_REFERENCE)
+        {
+            continue;
+        }
+
+        // Mark the ragdoll
+        int iType = RagdollRemove(iRagdoll, iRagDollType);
+        if(iType != VEFFECTS_RAGDOLL_DISSOLVE_EFFECTLESS)
+        {
+            bDissolve[iType] = true;
+        }
+    }
+
+    // i = dissolve type
+    for(int i = 0; i < VEFFECTS_RAGDOLL_DISSOLVE_MAX; i++)
+    {
+        // Validate marked ragdolls
+        if(bDissolve[i])
+        {
+            // Dissolve the whole batch
+            RagdollDissolve(i);
+        }
+    }
+
+    // Update the schedule
+    if(hTimer != INVALID_HANDLE || hRagdollTimer == INVALID_HANDLE)
+    {
+        RagdollQueueSchedule();
+    }
+
+    // Destroy timer
+    return Plugin_Stop;
+}
+
+/**
+ * Removed a ragdoll from the game or marks it for the dissolver.
+ * 
+ * @param iRagdoll          The ragdoll index.
+ * @param iRagDollType      The dissolve type.
+ * @return                  The dissolve type of the mark, or effectless, if removed.
+ **/
+int RagdollRemove(const int iRagdoll, int iRagDollType)
+{
     // Check the dissolve type
     if(iRagDollType == VEFFECTS_RAGDOLL_DISSOLVE_EFFECTLESS)
     {
         // Remove entity from world
         AcceptEntityInput(iRagdoll, "Kill");
-        return;
+        return VEFFECTS_RAGDOLL_DISSOLVE_EFFECTLESS;
     }
 
     // If random, set value to any between "energy" effect and "core" effect
@@ -99,56 +299,69 @@ void RagdollRemove(const int iRagdoll)
         iRagDollType = GetRandomInt(VEFFECTS_RAGDOLL_DISSOLVE_ENERGY, VEFFECTS_RAGDOLL_DISSOLVE_CORE);
     }
 
-    // Prep the ragdoll for dissolving
+    // Prep the ragdoll for dissolving, the name is shared by the batch
     static char sTarget[SMALL_LINE_LENGTH];
-    Format(sTarget, sizeof(sTarget), "zp_dissolve_%d", iRagdoll);
-    DispatchKeyValue(iRagdoll, "targetname", sTarget);
+    FormatEx(sTarget, sizeof(sTarget), "zp_dissolve_%d", iRagDollType);
+    SetEntPropString(iRagdoll, Prop_Data, "m_iName", sTarget);
+    return iRagDollType;
+}
+
+/**
+ * Dissolve all marked ragdolls of the type.
+ * 
+ * @param iRagDollType      The dissolve type.
+ **/
+void RagdollDissolve(const int iRagDollType)
+{
+    // Gets the dissolver
+    int iDissolver = RagdollGetDissolver(iRagDollType);
 
-    // Prep the dissolve entity
-    int iDissolver = CreateEntityByName("env_entity_dissolver");
-    
     // If dissolve entity isn't valid, then stop
     if(iDissolver != INVALID_ENT_REFERENCE)
     {
-        // Sets the target to the ragdoll
-        DispatchKeyValue(iDissolver, "target", sTarget);
-
-        // Sets the dissolve type
-        static char sDissolveType[SMALL_LINE_LENGTH];
-        Format(sDissolveType, sizeof(sDissolveType), "%d", iRagDollType);
-        DispatchKeyValue(iDissolver, "dissolvetype", sDissolveType);
+        // Sets the target to the marked ragdolls
+        static char sTarget[SMALL_LINE_LENGTH];
+        FormatEx(sTarget, sizeof(sTarget), "zp_dissolve_%d", iRagDollType);
+        SetVariantString(sTarget);
 
-        // Tell the entity to dissolve the ragdoll
+        // Tell the entity to dissolve the ragdolls
         AcceptEntityInput(iDissolver, "Dissolve");
-
-        // Remove the dissolver
-        AcceptEntityInput(iDissolver, "Kill");
     }
 }
 
 /**
- * Timer callback. Removed a client ragdoll.
+ * Gets the shared dissolver of the type, and creates it, if it was removed by the round cleanup.
  * 
- * @param hTimer            The timer handle. 
- * @param referenceIndex    The reference index.
+ * @param iRagDollType      The dissolve type.
+ * @return                  The dissolver index.
  **/
-public Action RagdollTimer(Handle hTimer, const int referenceIndex)
+int RagdollGetDissolver(const int iRagDollType)
 {
-    // Get the ragdoll index from the reference
-    int iRagdoll = EntRefToEntIndex(referenceIndex);
-
-    // If the ragdoll is already gone, then stop
-    if(iRagdoll != INVALID_ENT_REFERENCE)
+    // Validate the stored dissolver
+    int iDissolver = EntRefToEntIndex(gRagdollDissolver[iRagDollType]);
+    if(iDissolver != INVALID_ENT_REFERENCE)
     {
-        // Make sure this edict is still a ragdoll and not become a new valid entity
-        static char sClassname[SMALL_LINE_LENGTH];
-        GetEdictClassname(iRagdoll, sClassname, sizeof(sClassname));
+        return iDissolver;
+    }
 
-        // Validate classname
-        if(!strcmp(sClassname, "cs_ragdoll", false))
-        {
-            // Remove the ragdoll
-            RagdollRemove(iRagdoll);
-        }
+    // Prep the dissolve entity
+    iDissolver = CreateEntityByName("env_entity_dissolver");
+    
+    // If dissolve entity isn't valid, then stop
+    if(iDissolver == INVALID_ENT_REFERENCE)
+    {
+        return INVALID_ENT_REFERENCE;
     }
+
+    // Sets the dissolve type
+    static char sDissolveType[SMALL_LINE_LENGTH];
+    FormatEx(sDissolveType, sizeof(sDissolveType), "%d", iRagDollType);
+    DispatchKeyValue(iDissolver, "dissolvetype", sDissolveType);
+
+    // Spawn the entity
+    DispatchSpawn(iDissolver);
+
+    // Store the reference
+    gRagdollDissolver[iRagDollType] = EntIndexToEntRef(iDissolver);
+    return iDissolver;
 }
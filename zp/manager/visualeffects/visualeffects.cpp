@@ -61,6 +61,7 @@ void VEffectsLoad(/*void*/)
     // Forward event to sub-modules
     VAmbienceLoad();
     VOverlayLoad();
+    RagdollLoad();
 }
 
 /**
@@ -94,6 +94,9 @@ void WeaponsInit(/*void*/)
  **/
 void WeaponsLoad(/*void*/)
 {
+    // Forward event to sub-modules
+    WeaponHDRLoad();
+    
     // Register config file
     ConfigRegisterConfig(File_Weapons, Structure_Keyvalue, CONFIG_FILE_ALIAS_WEAPONS);
 
@@ -112,7 +115,8 @@ void WeaponsLoad(/*void*/)
     ConfigSetConfigPath(File_Weapons, sPathWeapons);
 
     // Load config from file and create array structure
-    bool bSuccess = ConfigLoadConfig(File_Weapons, arrayWeapons);
+    bool bCached;
+    bool bSuccess = ConfigLoadConfig(File_Weapons, arrayWeapons, _, bCached);
 
     // Unexpected error, stop plugin
     if(!bSuccess)
@@ -127,13 +131,16 @@ void WeaponsLoad(/*void*/)
         LogEvent(false, LogType_Fatal, LOG_CORE_EVENTS, LogModule_Weapons, "Config Validation", "No usable data found in weapons config file: \"%s\"", sPathWeapons);
     }
 
-    // Now copy data to array structure
-    WeaponsCacheData();
+    // Now copy data to array structure, or only precache the kept data
+    if(bCached) WeaponsPrecacheData(); else WeaponsCacheData();
 
     // Sets config data
     ConfigSetConfigLoaded(File_Weapons, true);
     ConfigSetConfigReloadFunc(File_Weapons, GetFunctionByName(GetMyHandle(), "WeaponsOnConfigReload"));
     ConfigSetConfigHandle(File_Weapons, arrayWeapons);
+
+    // Rebuild market templates
+    MenusPurgeTemplates("market:");
 }
 
 /**
@@ -168,64 +175,117 @@ void WeaponsCacheData(/*void*/)
             continue;
         }
         
-        // Validate translation
-        if(!TranslationPhraseExists(sPathWeapons))
-        {
-            // Log weapon error
-            LogEvent(false, LogType_Error, LOG_CORE_EVENTS, LogModule_Weapons, "Config Validation", "Couldn't cache weapon name: \"%s\" (check translation file)", sPathWeapons);
-        }
+        // Cache the entry
+        WeaponsOnCacheEntry(kvWeapons, i);
+    }
 
-        // Gets array size
-        ArrayList arrayWeapon = arrayWeapons.Get(i); 
- 
-        // Push data into array
-        kvWeapons.GetString("info", sPathWeapons, sizeof(sPathWeapons), "");
-        if(!TranslationPhraseExists(sPathWeapons) && strlen(sPathWeapons))
+    // We're done with this file now, so we can close it
+    delete kvWeapons;
+}
+
+/**
+ * Precaches the weapon data, which was kept from the previous map.
+ **/
+void WeaponsPrecacheData(/*void*/)
+{
+    // Initialize variable
+    static char sPathWeapons[PLATFORM_MAX_PATH];
+    
+    // i = array index
+    int iSize = arrayWeapons.Length;
+    for(int i = 0; i < iSize; i++)
+    {
+        // Validate the cached entry
+        ArrayList arrayWeapon = arrayWeapons.Get(i);
+        if(arrayWeapon.Length <= WEAPONS_DATA_SEQUENCE_SWAP)
         {
-            // Log weapon error
-            LogEvent(false, LogType_Error, LOG_CORE_EVENTS, LogModule_Weapons, "Native Validation", "Couldn't cache weapon info: \"%s\" (check translation file)", sPathWeapons);
+            continue;
         }
-        arrayWeapon.PushString(sPathWeapons);                 // Index: 1
-        kvWeapons.GetString("entity", sPathWeapons, sizeof(sPathWeapons), "");
-        arrayWeapon.PushString(sPathWeapons);                 // Index: 2
-        kvWeapons.GetString("group", sPathWeapons, sizeof(sPathWeapons), "");
-        arrayWeapon.PushString(sPathWeapons);                 // Index: 3
-        arrayWeapon.Push(kvWeapons.GetNum("cost", 0));        // Index: 4
-        arrayWeapon.Push(kvWeapons.GetNum("slot", 0));        // Index: 5
-        arrayWeapon.Push(kvWeapons.GetNum("level", 0));       // Index: 6
-        arrayWeapon.Push(kvWeapons.GetNum("online", 0));      // Index: 7
-        arrayWeapon.Push(kvWeapons.GetFloat("damage", 1.0));  // Index: 8
-        arrayWeapon.Push(kvWeapons.GetFloat("knock", 1.0));   // Index: 9
-        arrayWeapon.Push(kvWeapons.GetNum("clip", 0));        // Index: 10
-        arrayWeapon.Push(kvWeapons.GetNum("ammo", 0));        // Index: 11
-        arrayWeapon.Push(kvWeapons.GetFloat("speed", 0.0));   // Index: 12
-        arrayWeapon.Push(kvWeapons.GetFloat("reload", 0.0));  // Index: 13
-        arrayWeapon.Push(kvWeapons.GetFloat("deploy", 0.0));  // Index: 14
-        kvWeapons.GetString("sound", sPathWeapons, sizeof(sPathWeapons), "");
-        arrayWeapon.Push(SoundsKeyToIndex(sPathWeapons));     // Index: 15
-        arrayWeapon.Push(kvWeapons.GetNum("class", 0));       // Index: 16
-        kvWeapons.GetString("view", sPathWeapons, sizeof(sPathWeapons), "");
-        arrayWeapon.PushString(sPathWeapons);                 // Index: 17    
-        arrayWeapon.Push(ModelsPrecacheWeapon(sPathWeapons)); // Index: 18
-        kvWeapons.GetString("world", sPathWeapons, sizeof(sPathWeapons), "");
-        arrayWeapon.PushString(sPathWeapons);                 // Index: 19
-        arrayWeapon.Push(ModelsPrecacheStatic(sPathWeapons)); // Index: 20
-        kvWeapons.GetString("dropped", sPathWeapons, sizeof(sPathWeapons), "");
-        arrayWeapon.PushString(sPathWeapons);                 // Index: 21
-        arrayWeapon.Push(ModelsPrecacheStatic(sPathWeapons)); // Index: 22
-        int iBody[4]; kvWeapons.GetColor4("body", iBody);
-        arrayWeapon.PushArray(iBody);                         // Index: 23
-        int iSkin[4]; kvWeapons.GetColor4("skin", iSkin);
-        arrayWeapon.PushArray(iSkin);                         // Index: 24
-        kvWeapons.GetString("muzzle", sPathWeapons, sizeof(sPathWeapons), "");
-        arrayWeapon.PushString(sPathWeapons);                 // Index: 25
-        arrayWeapon.Push(kvWeapons.GetFloat("heat", 0.5));    // Index: 26
-        arrayWeapon.Push(-1); int iSeq[WeaponsSequencesMax];  // Index: 27
-        arrayWeapon.PushArray(iSeq);                          // Index: 28
+        
+        // Update the model indexes, which are changed on the map start
+        arrayWeapon.GetString(WEAPONS_DATA_MODEL_WORLD, sPathWeapons, sizeof(sPathWeapons));
+        arrayWeapon.Set(WEAPONS_DATA_MODEL_WORLD_ID, ModelsPrecacheStatic(sPathWeapons));
+        arrayWeapon.GetString(WEAPONS_DATA_MODEL_DROP, sPathWeapons, sizeof(sPathWeapons));
+        arrayWeapon.Set(WEAPONS_DATA_MODEL_DROP_ID, ModelsPrecacheStatic(sPathWeapons));
+        arrayWeapon.GetString(WEAPONS_DATA_MODEL_VIEW, sPathWeapons, sizeof(sPathWeapons));
+        arrayWeapon.Set(WEAPONS_DATA_MODEL_VIEW_ID, ModelsPrecacheWeapon(sPathWeapons));
+        
+        // Build the sequence swap table of the viewmodel
+        WeaponsSetSequenceCount(i, -1);
+        WeaponHDRPrecacheSequences(i, sPathWeapons, WeaponsGetModelViewID(i));
     }
+}
 
-    // We're done with this file now, so we can close it
-    delete kvWeapons;
+/**
+ * Caches the data of one weapon from the keyvalue section.
+ *
+ * @param kvWeapons         The keyvalue handle, which is on the weapon section.
+ * @param iD                The weapon index.
+ **/
+public void WeaponsOnCacheEntry(KeyValues kvWeapons, int iD)
+{
+    // Gets the weapon name
+    static char sPathWeapons[PLATFORM_MAX_PATH];
+    WeaponsGetName(iD, sPathWeapons, sizeof(sPathWeapons));
+
+    // Validate translation
+    if(!TranslationPhraseExists(sPathWeapons))
+    {
+        // Log weapon error
+        LogEvent(false, LogType_Error, LOG_CORE_EVENTS, LogModule_Weapons, "Config Validation", "Couldn't cache weapon name: \"%s\" (check translation file)", sPathWeapons);
+    }
+
+    // Gets array size
+    ArrayList arrayWeapon = arrayWeapons.Get(iD); 
+ 
+    // Push data into array
+    kvWeapons.GetString("info", sPathWeapons, sizeof(sPathWeapons), "");
+    if(!TranslationPhraseExists(sPathWeapons) && strlen(sPathWeapons))
+    {
+        // Log weapon error
+        LogEvent(false, LogType_Error, LOG_CORE_EVENTS, LogModule_Weapons, "Native Validation", "Couldn't cache weapon info: \"%s\" (check translation file)", sPathWeapons);
+    }
+    arrayWeapon.PushString(sPathWeapons);                 // Index: 1
+    kvWeapons.GetString("entity", sPathWeapons, sizeof(sPathWeapons), "");
+    arrayWeapon.PushString(sPathWeapons);                 // Index: 2
+    kvWeapons.GetString("group", sPathWeapons, sizeof(sPathWeapons), "");
+    arrayWeapon.PushString(sPathWeapons);                 // Index: 3
+    arrayWeapon.Push(kvWeapons.GetNum("cost", 0));        // Index: 4
+    arrayWeapon.Push(kvWeapons.GetNum("slot", 0));        // Index: 5
+    arrayWeapon.Push(kvWeapons.GetNum("level", 0));       // Index: 6
+    arrayWeapon.Push(kvWeapons.GetNum("online", 0));      // Index: 7
+    arrayWeapon.Push(kvWeapons.GetFloat("damage", 1.0));  // Index: 8
+    arrayWeapon.Push(kvWeapons.GetFloat("knock", 1.0));   // Index: 9
+    arrayWeapon.Push(kvWeapons.GetNum("clip", 0));        // Index: 10
+    arrayWeapon.Push(kvWeapons.GetNum("ammo", 0));        // Index: 11
+    arrayWeapon.Push(kvWeapons.GetFloat("speed", 0.0));   // Index: 12
+    arrayWeapon.Push(kvWeapons.GetFloat("reload", 0.0));  // Index: 13
+    arrayWeapon.Push(kvWeapons.GetFloat("deploy", 0.0));  // Index: 14
+    kvWeapons.GetString("sound", sPathWeapons, sizeof(sPathWeapons), "");
+    arrayWeapon.Push(SoundsKeyToIndex(sPathWeapons));     // Index: 15
+    arrayWeapon.Push(kvWeapons.GetNum("class", 0));       // Index: 16
+    kvWeapons.GetString("view", sPathWeapons, sizeof(sPathWeapons), "");
+    arrayWeapon.PushString(sPathWeapons);                 // Index: 17    
+    arrayWeapon.Push(ModelsPrecacheWeapon(sPathWeapons)); // Index: 18
+    kvWeapons.GetString("world", sPathWeapons, sizeof(sPathWeapons), "");
+    arrayWeapon.PushString(sPathWeapons);                 // Index: 19
+    arrayWeapon.Push(ModelsPrecacheStatic(sPathWeapons)); // Index: 20
+    kvWeapons.GetString("dropped", sPathWeapons, sizeof(sPathWeapons), "");
+    arrayWeapon.PushString(sPathWeapons);                 // Index: 21
+    arrayWeapon.Push(ModelsPrecacheStatic(sPathWeapons)); // Index: 22
+    int iBody[4]; kvWeapons.GetColor4("body", iBody);
+    arrayWeapon.PushArray(iBody);                         // Index: 23
+    int iSkin[4]; kvWeapons.GetColor4("skin", iSkin);
+    arrayWeapon.PushArray(iSkin);                         // Index: 24
+    kvWeapons.GetString("muzzle", sPathWeapons, sizeof(sPathWeapons), "");
+    arrayWeapon.PushString(sPathWeapons);                 // Index: 25
+    arrayWeapon.Push(kvWeapons.GetFloat("heat", 0.5));    // Index: 26
+    arrayWeapon.Push(-1); int iSeq[WeaponsSequencesMax];  // Index: 27
+    arrayWeapon.PushArray(iSeq);                          // Index: 28
+    
+    // Build the sequence swap table of the viewmodel
+    WeaponsGetModelView(iD, sPathWeapons, sizeof(sPathWeapons));
+    WeaponHDRPrecacheSequences(iD, sPathWeapons, WeaponsGetModelViewID(iD));
 }
 
 /**
@@ -233,8 +293,12 @@ void WeaponsCacheData(/*void*/)
  **/
 public void WeaponsOnConfigReload(/*void*/)
 {
-    // Reload weapons config
-    WeaponsLoad();
+    // Reload only the changed weapons
+    if(ConfigReloadKeyvalue(File_Weapons, arrayWeapons, GetFunctionByName(GetMyHandle(), "WeaponsOnCacheEntry")) > 0)
+    {
+        // Rebuild market templates
+        MenusPurgeTemplates("market:");
+    }
 }
 
 /**
@@ -257,6 +321,15 @@ void WeaponsOnCommandsCreate(/*void*/)
     WeaponSDKOnCommandsCreate();
 }
 
+/**
+ * Hook weapons cvar changes.
+ **/
+void WeaponsOnCvarInit(/*void*/)
+{
+    // Forward event to sub-modules
+    WeaponSDKOnCvarInit();
+}
+
 /**
  * Client is joining the server.
  * 
@@ -268,6 +341,17 @@ void WeaponsClientInit(const int clientIndex)
     WeaponSDKClientInit(clientIndex);
 }
 
+/**
+ * Client has been disconnected.
+ * 
+ * @param clientIndex       The client index.  
+ **/
+void WeaponsOnClientDisconnect(const int clientIndex)
+{
+    // Forward event to sub-modules
+    WeaponSDKOnClientDisconnect(clientIndex);
+}
+
 /**
  * Client has been fired.
  *
@@ -1809,6 +1893,9 @@ stock int WeaponsNameToIndex(char[] sName, const int iMaxLen = 0, const bool bOv
     int iSize = arrayWeapons.Length;
     for (int i = 0; i < iSize; i++)
     {
+        // Skip the weapon, which was removed by the reload
+        if(ConfigIsEntryRemoved(File_Weapons, i)) continue;
+        
         // Gets weapon name 
         WeaponsGetName(i, sWeaponName, sizeof(sWeaponName));
         
@@ -541,7 +541,7 @@ void WeaponAttachCreateAddons(const int clientIndex, const int iD, const WeaponA
                 AcceptEntityInput(entityIndex, "SetParentAttachment", clientIndex, entityIndex);
                 
                 // Hook entity callbacks
-                SDKHook(entityIndex, SDKHook_SetTransmit, WeaponAttachmentOnTransmit);
+                SDKHook(entityIndex, SDKHook_SetTransmit, DebugOnAttachmentTransmit);
                 
                 // Store the client cache
                 gClientData[clientIndex][Client_AttachmentAddons][bitType] = EntIndexToEntRef(entityIndex);
@@ -50,6 +50,11 @@
  **/
 Handle hSDKCallAnimatingGetSequenceActivity;
 
+/**
+ * Map to store the sequence swap tables by the model index.
+ **/
+StringMap trieSequenceSwap;
+
 /**
  * Variables to store virtual SDK adresses.
  **/
@@ -109,6 +114,146 @@ void WeaponHDRInit(/*void*/)
     
     // StudioHdr offset in gameconf is only relative to the offset of m_hLightingOrigin, in order to make the offset more resilient to game updates
     Animating_StudioHdr += lightingOriginOffset;
+    
+    // Initialize the sequence tables
+    trieSequenceSwap = CreateTrie();
+}
+
+/**
+ * Clear the sequence tables, because model indexes are changed on the map start.
+ **/
+void WeaponHDRLoad(/*void*/)
+{
+    // Clear the sequence tables
+    trieSequenceSwap.Clear();
+}
+
+/**
+ * Build the sequence swap table of the weapon viewmodel during precache.
+ *
+ * @param iD                The weapon id.
+ * @param sModel            The model path.
+ * @param iModel            The model index.
+ **/
+void WeaponHDRPrecacheSequences(const int iD, const char[] sModel, const int iModel)
+{
+    // Validate model
+    if(!iModel)
+    {
+        return;
+    }
+    
+    // Initialize the sequence array
+    int iSequences[WeaponsSequencesMax]; int nSequenceCount;
+
+    // Validate the shared table
+    if(!WeaponHDRGetSequences(iModel, iSequences, nSequenceCount))
+    {
+        // Validate the manifest cache
+        if(!ModelsManifestGetSequences(sModel, iSequences, sizeof(iSequences), nSequenceCount))
+        {
+            // Create a temporary animating entity
+            int entityIndex = CreateEntityByName("prop_dynamic_override");
+            
+            // Validate entity
+            if(entityIndex == INVALID_ENT_REFERENCE)
+            {
+                return;
+            }
+            
+            // Dispatch main values of the entity
+            DispatchKeyValue(entityIndex, "model", sModel);
+            DispatchSpawn(entityIndex);
+            
+            // Gets the sequence amount from the entity
+            nSequenceCount = Animating_GetSequenceCount(entityIndex);
+
+            // Validate amount
+            if(nSequenceCount > 0 && nSequenceCount < WeaponsSequencesMax)
+            {
+                // Build the sequence array
+                WeaponHDRBuildSwapSequenceArray(iSequences, nSequenceCount, entityIndex);
+            }
+
+            // Remove the entity
+            RemoveEdict(entityIndex);
+            
+            // Validate amount, otherwise it will be built on the deploy
+            if(nSequenceCount <= 0 || nSequenceCount >= WeaponsSequencesMax)
+            {
+                return;
+            }
+            
+            // Store into the manifest cache
+            ModelsManifestSetSequences(sModel, iSequences, nSequenceCount);
+        }
+
+        // Store into the shared table
+        WeaponHDRSetSequences(iModel, iSequences, nSequenceCount);
+    }
+    
+    // Update the sequence array
+    WeaponsSetSequenceCount(iD, nSequenceCount);
+    WeaponsSetSequenceSwap(iD, iSequences, sizeof(iSequences));
+}
+
+/**
+ * Gets the sequence swap table of the model.
+ *
+ * @param iModel            The model index.
+ * @param iSequences        The sequence array.
+ * @param nSequenceCount    The sequence count.
+ * @return                  True if the table exists, false otherwise.
+ **/
+bool WeaponHDRGetSequences(const int iModel, int iSequences[WeaponsSequencesMax], int &nSequenceCount)
+{
+    // Initialize variables
+    static char sKey[SMALL_LINE_LENGTH]; static int iTable[WeaponsSequencesMax + 1];
+    IntToString(iModel, sKey, sizeof(sKey));
+    
+    // Validate table
+    if(!trieSequenceSwap.GetArray(sKey, iTable, sizeof(iTable)))
+    {
+        return false;
+    }
+
+    // Gets the sequence count
+    nSequenceCount = iTable[0];
+    
+    // i = sequence index
+    for(int i = 0; i < WeaponsSequencesMax; i++)
+    {
+        iSequences[i] = iTable[i + 1];
+    }
+    
+    // Return on success
+    return true;
+}
+
+/**
+ * Sets the sequence swap table of the model.
+ *
+ * @param iModel            The model index.
+ * @param iSequences        The sequence array.
+ * @param nSequenceCount    The sequence count.
+ **/
+void WeaponHDRSetSequences(const int iModel, const int iSequences[WeaponsSequencesMax], const int nSequenceCount)
+{
+    // Initialize variables
+    static char sKey[SMALL_LINE_LENGTH]; static int iTable[WeaponsSequencesMax + 1];
+    IntToString(iModel, sKey, sizeof(sKey));
+
+    // Sets the sequence count
+    iTable[0] = nSequenceCount;
+    
+    // i = sequence index
+    for(int i = 0; i < WeaponsSequencesMax; i++)
+    {
+        iTable[i + 1] = iSequences[i];
+    }
+    
+    // Store the table
+    trieSequenceSwap.SetArray(sKey, iTable, sizeof(iTable));
 }
 
 /**
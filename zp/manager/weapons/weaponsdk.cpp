@@ -263,7 +263,118 @@ void WeaponSDKClientInit(const int clientIndex)
     SDKHook(clientIndex, SDKHook_WeaponSwitch, WeaponSDKOnDeploy);
     SDKHook(clientIndex, SDKHook_WeaponSwitchPost, WeaponSDKOnDeployPost);
     SDKHook(clientIndex, SDKHook_WeaponDrop , WeaponSDKOnDrop);
-    SDKHook(clientIndex, SDKHook_PostThinkPost, WeaponSDKOnAnimationFix);
+    SDKHook(clientIndex, SDKHook_PostThinkPost, DebugOnPostThinkPost);
+}
+
+/**
+ * Client has been disconnected.
+ * 
+ * @param clientIndex       The client index.  
+ **/
+void WeaponSDKOnClientDisconnect(const int clientIndex)
+{
+    // Release the weapon events of the client
+    WeaponSDKSetHooks(clientIndex, 0);
+}
+
+/**
+ * Hook weapon cvar changes.
+ **/
+void WeaponSDKOnCvarInit(/*void*/)
+{
+    // Hook cvars
+    HookConVarChange(gCvarList[CVAR_HUMAN_INF_AMMUNITION],    WeaponSDKOnCvarHook);
+    HookConVarChange(gCvarList[CVAR_SURVIVOR_INF_AMMUNITION], WeaponSDKOnCvarHook);
+}
+
+/**
+ * Cvar hook callback (zp_human_inf_ammunition, zp_survivor_inf_ammunition)
+ * Updates the weapon events of the held weapons.
+ * 
+ * @param hConVar           The cvar handle.
+ * @param oldValue          The value before the attempted change.
+ * @param newValue          The new value.
+ **/
+public void WeaponSDKOnCvarHook(ConVar hConVar, const char[] oldValue, const char[] newValue)
+{
+    // i = client index
+    for(int i = 1; i <= MaxClients; i++)
+    {
+        // Validate client
+        if(IsPlayerExist(i))
+        {
+            // Update the weapon events
+            WeaponSDKSetHooks(i, WeaponSDKGetHooks(i, GetEntDataEnt2(i, g_iOffset_PlayerActiveWeapon)));
+        }
+    }
+}
+
+/**
+ * Gets the weapon events, which are needed by the weapon.
+ * 
+ * @param clientIndex       The client index.
+ * @param weaponIndex       The weapon index.
+ * @return                  The weapon event flags. (EVENT_HOOK_*)
+ **/
+int WeaponSDKGetHooks(const int clientIndex, const int weaponIndex)
+{
+    // Validate weapon
+    if(!IsValidEdict(weaponIndex))
+    {
+        return 0;
+    }
+
+    // Initialize flags
+    int iHooks;
+    
+    // Validate custom index
+    int iD = WeaponsGetCustomID(weaponIndex);
+    if(iD != INVALID_ENT_REFERENCE)
+    {
+        // Validate fire speed, muzzle and the forward
+        if(WeaponsGetSpeed(iD) || (WeaponsGetModelViewID(iD) && CVAR_MIRROR(Mirror_GameCustomModels)) || GetForwardFunctionCount(gForwardsList[OnWeaponFire])) iHooks |= EVENT_HOOK_FIRE;
+        
+        // Validate the forward
+        if(GetForwardFunctionCount(gForwardsList[OnWeaponBullet])) iHooks |= EVENT_HOOK_BULLET;
+        
+        // Validate shoot sound and the forward
+        if(WeaponsGetSoundID(iD) || GetForwardFunctionCount(gForwardsList[OnWeaponShoot])) iHooks |= EVENT_HOOK_SHOOT;
+    }
+    
+    // Validate infinity ammunition of a non-knife
+    if(!WeaponsValidateKnife(weaponIndex) && !WeaponsValidateTaser(weaponIndex) && (gClientData[clientIndex][Client_Survivor] ? CVAR_MIRROR(Mirror_SurvivorInfAmmunition) : CVAR_MIRROR(Mirror_HumanInfAmmunition))) iHooks |= EVENT_HOOK_FIRE;
+    
+    // Return on success
+    return iHooks;
+}
+
+/**
+ * Sets the weapon events of the client and updates the hooked events.
+ * 
+ * @param clientIndex       The client index.
+ * @param iHooks            The weapon event flags. (EVENT_HOOK_*)
+ **/
+void WeaponSDKSetHooks(const int clientIndex, const int iHooks)
+{
+    // Validate changes
+    if(gClientData[clientIndex][Client_WeaponHooks] == iHooks)
+    {
+        return;
+    }
+    
+    // Sets the flags
+    gClientData[clientIndex][Client_WeaponHooks] = iHooks;
+    
+    // i = client index
+    int iAll;
+    for(int i = 1; i <= MaxClients; i++)
+    {
+        // Collect the flags
+        iAll |= gClientData[i][Client_WeaponHooks];
+    }
+    
+    // Update the events
+    EventHookWeapons(iAll);
 }
 
 /**
@@ -514,7 +625,7 @@ public void WeaponSDKOnFakeGrenadeSpawn(const int referenceIndex)
                 WeaponsSetCustomID(grenadeIndex, iD);
 
                 // If custom weapons models disabled, then skip
-                if(gCvarList[CVAR_GAME_CUSTOM_MODELS].BoolValue)
+                if(CVAR_MIRROR(Mirror_GameCustomModels))
                 {
                     // If dropmodel exist, then apply it
                     if(WeaponsGetModelDropID(iD))
@@ -549,7 +660,7 @@ public void WeaponSDKOnFakeGrenadeSpawn(const int referenceIndex)
 public Action WeaponSDKOnDrop(const int clientIndex, const int weaponIndex)
 {
     // If custom weapons models disabled, then skip
-    if(gCvarList[CVAR_GAME_CUSTOM_MODELS].BoolValue)
+    if(CVAR_MIRROR(Mirror_GameCustomModels))
     {
         // Validate weapon
         if(IsValidEdict(weaponIndex))
@@ -715,6 +826,9 @@ void WeaponSDKOnClientDeath(const int clientIndex)
     // Clear the data
     gClientData[clientIndex][Client_ViewModels] = { INVALID_ENT_REFERENCE, INVALID_ENT_REFERENCE };
     gClientData[clientIndex][Client_CustomWeapon] = 0;
+    
+    // Release the weapon events of the client
+    WeaponSDKSetHooks(clientIndex, 0);
 }
 
 /**
@@ -726,6 +840,12 @@ void WeaponSDKOnClientDeath(const int clientIndex)
  **/
 public void WeaponSDKOnDeploy(const int clientIndex, const int weaponIndex) 
 {
+    // Kill the tasks of the previous weapon
+    TasksOnClientDeploy(clientIndex, weaponIndex);
+    
+    // Update the weapon events
+    WeaponSDKSetHooks(clientIndex, WeaponSDKGetHooks(clientIndex, weaponIndex));
+    
     // Gets the entity index from the reference
     int viewModel1 = EntRefToEntIndex(gClientData[clientIndex][Client_ViewModels][0]);
     int viewModel2 = EntRefToEntIndex(gClientData[clientIndex][Client_ViewModels][1]);
@@ -777,7 +897,7 @@ public void WeaponSDKOnDeploy(const int clientIndex, const int weaponIndex)
             }
     
             // If custom weapons models disabled, then skip
-            if(gCvarList[CVAR_GAME_CUSTOM_MODELS].BoolValue)
+            if(CVAR_MIRROR(Mirror_GameCustomModels))
             {
                 // If view/world model exist, then set them
                 if(WeaponsGetModelViewID(iD) || WeaponsGetModelWorldID(iD) || ((WeaponsValidateKnife(weaponIndex) || WeaponsValidateGrenade(weaponIndex)) && gClientData[clientIndex][Client_Zombie]))
@@ -925,18 +1045,22 @@ public void WeaponSDKOnDeployPost(const int clientIndex, const int weaponIndex)
         // Sets the model entity for the weapon
         SetEntityModel(weaponIndex, sModel);
 
-        // If the sequence for the weapon didn't build yet
+        // If the sequence for the weapon didn't build on the precache
         if(WeaponsGetSequenceCount(iD) == -1)
         {
+            // Initialize the sequence array
+            int iSequences[WeaponsSequencesMax]; int nSequenceCount;
+            
+            // Validate the shared table of the model
+            if(WeaponHDRGetSequences(iModel, iSequences, nSequenceCount))
+            {
+                // Update the sequence array
+                WeaponsSetSequenceCount(iD, nSequenceCount);
+                WeaponsSetSequenceSwap(iD, iSequences, sizeof(iSequences));
+            }
             // Gets the sequence amount from a weapon entity
-            int nSequenceCount = Animating_GetSequenceCount(weaponIndex);
-
-            // Validate count
-            if(nSequenceCount)
+            else if((nSequenceCount = Animating_GetSequenceCount(weaponIndex)))
             {
-                // Initialize the sequence array
-                int iSequences[WeaponsSequencesMax];
-
                 // Validate amount
                 if(nSequenceCount < WeaponsSequencesMax)
                 {
@@ -946,6 +1070,10 @@ public void WeaponSDKOnDeployPost(const int clientIndex, const int weaponIndex)
                     // Update the sequence array
                     WeaponsSetSequenceCount(iD, nSequenceCount);
                     WeaponsSetSequenceSwap(iD, iSequences, sizeof(iSequences));
+                    
+                    // Store into the shared table and the manifest cache
+                    WeaponHDRSetSequences(iModel, iSequences, nSequenceCount);
+                    ModelsManifestSetSequences(sModel, iSequences, nSequenceCount);
                 }
                 else
                 {
@@ -1139,7 +1267,7 @@ void WeaponSDKOnFire(const int clientIndex, const int weaponIndex)
         }
         
         // If custom weapons models disabled, then skip
-        if(gCvarList[CVAR_GAME_CUSTOM_MODELS].BoolValue)
+        if(CVAR_MIRROR(Mirror_GameCustomModels))
         {
             // If viewmodel exist, then create muzzle smoke
             if(WeaponsGetModelViewID(iD))
@@ -1211,7 +1339,7 @@ void WeaponSDKOnFire(const int clientIndex, const int weaponIndex)
     if(!WeaponsValidateKnife(weaponIndex) && !WeaponsValidateTaser(weaponIndex)) 
     {
         // Validate current ammunition mode
-        switch(gClientData[clientIndex][Client_Survivor] ? gCvarList[CVAR_SURVIVOR_INF_AMMUNITION].IntValue : gCvarList[CVAR_HUMAN_INF_AMMUNITION].IntValue)
+        switch(gClientData[clientIndex][Client_Survivor] ? CVAR_MIRROR(Mirror_SurvivorInfAmmunition) : CVAR_MIRROR(Mirror_HumanInfAmmunition))
         {
             case 0 : return;
             // SetEntData(weaponIndex, g_iOffset_PlayerAmmo + (ammo_type<<2), iAmmo, _, true); 
@@ -1276,7 +1404,7 @@ Action WeaponSDKOnShoot(const int clientIndex, const int weaponIndex)
     if(iD != INVALID_ENT_REFERENCE)    
     {
         // Validate broadcast
-        Action resultHandle = SoundsInputEmitToAll(WeaponsGetSoundID(iD), 0, clientIndex, SNDCHAN_WEAPON, gCvarList[CVAR_GAME_CUSTOM_SOUND_LEVEL].IntValue) ? Plugin_Stop : Plugin_Continue;
+        Action resultHandle = SoundsInputEmitToAll(WeaponsGetSoundID(iD), 0, clientIndex, SNDCHAN_WEAPON, CVAR_MIRROR(Mirror_GameCustomSoundLevel)) ? Plugin_Stop : Plugin_Continue;
 
         // Call forward
         API_OnWeaponShoot(clientIndex, weaponIndex, iD);
@@ -1352,7 +1480,7 @@ public Action WeaponSDKOnAmmunition(const int clientIndex, const char[] commandM
     if(IsPlayerExist(clientIndex))
     {
         // Validate current ammunition mode
-        switch(gClientData[clientIndex][Client_Survivor] ? gCvarList[CVAR_SURVIVOR_INF_AMMUNITION].IntValue : gCvarList[CVAR_HUMAN_INF_AMMUNITION].IntValue)
+        switch(gClientData[clientIndex][Client_Survivor] ? CVAR_MIRROR(Mirror_SurvivorInfAmmunition) : CVAR_MIRROR(Mirror_HumanInfAmmunition))
         {
             case 0 : { /* empty statement */ }
             default: return Plugin_Continue;
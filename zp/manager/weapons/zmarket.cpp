@@ -217,19 +217,48 @@ void ZMarketSubMenu(const int clientIndex, const char[] sTitle, const int mSlot
         return;
     }
     
+    // Open rebuy menu
+    if(!mSlot)
+    {
+        ZMarketRebuySubMenu(clientIndex, sTitle);
+        return;
+    }
+
+    // Gets the template of the client language
+    static char sKey[SMALL_LINE_LENGTH];
+    FormatEx(sKey, sizeof(sKey), "market:%d:%d", GetClientLanguage(clientIndex), mSlot);
+    Menu hSubMenu = MenusGetTemplate(sKey);
+
+    // Validate template
+    if(hSubMenu == null)
+    {
+        // Build and store the template
+        hSubMenu = ZMarketSubMenuCreate(clientIndex, sTitle, mSlot);
+        MenusSetTemplate(sKey, hSubMenu);
+    }
+
+    // Display it, the states and counters are patched while drawing
+    hSubMenu.Display(clientIndex, MENU_TIME_FOREVER); 
+}
+
+/**
+ * Create the sub weapons menu template in the client language.
+ *
+ * @param clientIndex       The client index.
+ * @param sTitle            The menu title.
+ * @param mSlot             The slot index selected. (starting from 0)
+ * @return                  The menu handle.
+ **/
+Menu ZMarketSubMenuCreate(const int clientIndex, const char[] sTitle, const int mSlot) 
+{
     // Initialize variables
     static char sBuffer[NORMAL_LINE_LENGTH];
     static char sName[SMALL_LINE_LENGTH];
     static char sInfo[SMALL_LINE_LENGTH];
-    static char sLevel[SMALL_LINE_LENGTH];
-    static char sOnline[SMALL_LINE_LENGTH];
     static char sGroup[SMALL_LINE_LENGTH];
 
-    // Initialize counter
-    static int iCount;
-    
     // Create menu handle
-    Menu hSubMenu = CreateMenu(ZMarketMenuSubSlots);
+    Menu hSubMenu = CreateMenu(ZMarketMenuSubSlots, MENU_ACTIONS_DEFAULT | MenuAction_DrawItem | MenuAction_DisplayItem);
     
     // Sets the language to target
     SetGlobalTransTarget(clientIndex);
@@ -237,69 +266,83 @@ void ZMarketSubMenu(const int clientIndex, const char[] sTitle, const int mSlot
     // Sets title
     hSubMenu.SetTitle(sTitle);
     
-    // Open weapon menu
-    if(mSlot)
+    // i = weapon number
+    int iCount = arrayWeapons.Length;
+    for(int i = 0; i < iCount; i++)
     {
-        // i = weapon number
-        iCount = arrayWeapons.Length;
-        for(int i = 0; i < iCount; i++)
-        {
-            // Skip some weapons, if slot isn't equal
-            if(WeaponsGetSlot(i) != mSlot) continue;
+        // Skip some weapons, if slot isn't equal or weapon was removed by the reload
+        if(WeaponsGetSlot(i) != mSlot || ConfigIsEntryRemoved(File_Weapons, i)) continue;
 
-            // Skip some weapons, if class isn't equal
-            switch(WeaponsGetClass(i))
-            {
-                // Validate human class
-                case ClassType_Human : if(!(!gClientData[clientIndex][Client_Zombie] && !gClientData[clientIndex][Client_Survivor]))   continue;
-                
-                // Validate survivor class
-                case ClassType_Survivor : if(!(!gClientData[clientIndex][Client_Zombie] && gClientData[clientIndex][Client_Survivor])) continue;
-                
-                // Validate zombie class
-                case ClassType_Zombie : if(!(gClientData[clientIndex][Client_Zombie] && !gClientData[clientIndex][Client_Nemesis]))    continue;
-                
-                // Validate nemesis class
-                case ClassType_Nemesis : if(!(gClientData[clientIndex][Client_Zombie] && gClientData[clientIndex][Client_Nemesis]))    continue;
-            
-                // Validate invalid class
-                default: continue;
-            }
+        // Gets weapon data
+        WeaponsGetName(i, sName, sizeof(sName));
+        WeaponsGetGroup(i, sGroup, sizeof(sGroup));
+        
+        // Format some chars for showing in menu, the group is constant
+        Format(sBuffer, sizeof(sBuffer), (WeaponsGetCost(i)) ? "%t\t%s\t%t" : "%t\t%s", sName, sGroup, "price", WeaponsGetCost(i), "ammopack");
 
-            // Gets weapon data
-            WeaponsGetName(i, sName, sizeof(sName));
-            WeaponsGetGroup(i, sGroup, sizeof(sGroup));
-            
-            // Format some chars for showing in menu
-            Format(sLevel, sizeof(sLevel), "%t", "level", WeaponsGetLevel(i));
-            Format(sOnline, sizeof(sOnline), "%t", "online", WeaponsGetOnline(i));      
-            Format(sBuffer, sizeof(sBuffer), (WeaponsGetCost(i)) ? "%t\t%s\t%t" : "%t\t%s", sName, strlen(sGroup) ? sGroup : (gClientData[clientIndex][Client_Level] < WeaponsGetLevel(i)) ? sLevel : (fnGetPlaying() < WeaponsGetOnline(i)) ? sOnline : "", "price", WeaponsGetCost(i), "ammopack");
-   
-            // Show option
-            IntToString(i, sInfo, sizeof(sInfo));
-            hSubMenu.AddItem(sInfo, sBuffer, MenuGetItemDraw((!IsPlayerInGroup(clientIndex, sGroup) && strlen(sGroup)) || (WeaponsIsExist(clientIndex, i) || gClientData[clientIndex][Client_Level] < WeaponsGetLevel(i) || fnGetPlaying() < WeaponsGetOnline(i) || gClientData[clientIndex][Client_AmmoPacks] < WeaponsGetCost(i)) ? false : true));
-        }
+        // Show option
+        IntToString(i, sInfo, sizeof(sInfo));
+        hSubMenu.AddItem(sInfo, sBuffer);
     }
-    // Otherwise open rebuy menu
-    else
+    
+    // If there are no cases, add an "(Empty)" line
+    if(!iCount)
     {
-        // i = array number
-        iCount = arrayShoppingList[clientIndex].Length;
-        for(int i = 0; i < iCount; i++)
-        {
-            // Gets weapon id from the list
-            int iD = arrayShoppingList[clientIndex].Get(i);
+        static char sEmpty[SMALL_LINE_LENGTH];
+        Format(sEmpty, sizeof(sEmpty), "%t", "empty");
+
+        hSubMenu.AddItem("empty", sEmpty, ITEMDRAW_DISABLED);
+    }
+    
+    // Sets exit and back button
+    hSubMenu.ExitBackButton = true;
+
+    // Sets options
+    hSubMenu.OptionFlags = MENUFLAG_BUTTON_EXIT | MENUFLAG_BUTTON_EXITBACK;
+    return hSubMenu;
+}
+
+/**
+ * Create the rebuy menu. The shopping list is personal, so it isn't cached.
+ *
+ * @param clientIndex       The client index.
+ * @param sTitle            The menu title.
+ **/
+void ZMarketRebuySubMenu(const int clientIndex, const char[] sTitle) 
+{
+    // Initialize variables
+    static char sBuffer[NORMAL_LINE_LENGTH];
+    static char sName[SMALL_LINE_LENGTH];
+    static char sInfo[SMALL_LINE_LENGTH];
+
+    // Create menu handle
+    Menu hSubMenu = CreateMenu(ZMarketMenuRebuySlots);
+    
+    // Sets the language to target
+    SetGlobalTransTarget(clientIndex);
+    
+    // Sets title
+    hSubMenu.SetTitle(sTitle);
+    
+    // i = array number
+    int iCount = arrayShoppingList[clientIndex].Length;
+    for(int i = 0; i < iCount; i++)
+    {
+        // Gets weapon id from the list
+        int iD = arrayShoppingList[clientIndex].Get(i);
         
-            // Gets weapon name
-            WeaponsGetName(iD, sName, sizeof(sName));
+        // Skip the weapon, which was removed by the reload
+        if(ConfigIsEntryRemoved(File_Weapons, iD)) continue;
+    
+        // Gets weapon name
+        WeaponsGetName(iD, sName, sizeof(sName));
 
-            // Format some chars for showing in menu
-            Format(sBuffer, sizeof(sBuffer), (WeaponsGetCost(iD)) ? "%t\t%t" : "%s", sName, "price", WeaponsGetCost(iD), "ammopack");
+        // Format some chars for showing in menu
+        Format(sBuffer, sizeof(sBuffer), (WeaponsGetCost(iD)) ? "%t\t%t" : "%s", sName, "price", WeaponsGetCost(iD), "ammopack");
 
-            // Show option
-            IntToString(iD, sInfo, sizeof(sInfo));
-            hSubMenu.AddItem(sInfo, sBuffer, MenuGetItemDraw((WeaponsIsExist(clientIndex, iD) || gClientData[clientIndex][Client_Level] < WeaponsGetLevel(iD) || fnGetPlaying() < WeaponsGetOnline(iD) || gClientData[clientIndex][Client_AmmoPacks] < WeaponsGetCost(iD)) ? false : true));
-        }
+        // Show option
+        IntToString(iD, sInfo, sizeof(sInfo));
+        hSubMenu.AddItem(sInfo, sBuffer, MenuGetItemDraw((WeaponsIsExist(clientIndex, iD) || gClientData[clientIndex][Client_Level] < WeaponsGetLevel(iD) || fnGetPlaying() < WeaponsGetOnline(iD) || gClientData[clientIndex][Client_AmmoPacks] < WeaponsGetCost(iD)) ? false : true));
     }
     
     // If there are no cases, add an "(Empty)" line
@@ -319,6 +362,56 @@ void ZMarketSubMenu(const int clientIndex, const char[] sTitle, const int mSlot
     hSubMenu.Display(clientIndex, MENU_TIME_FOREVER); 
 }
 
+/**
+ * Called when client selects option in the rebuy menu, and handles it.
+ *  
+ * @param hSubMenu          The handle of the sub menu being used.
+ * @param mAction           The action done on the menu (see menus.inc, enum MenuAction).
+ * @param clientIndex       The client index.
+ * @param mSlot             The slot index selected (starting from 0).
+ **/ 
+public int ZMarketMenuRebuySlots(Menu hSubMenu, MenuAction mAction, const int clientIndex, const int mSlot)
+{
+    // Client hit 'Exit' button
+    if(mAction == MenuAction_End)
+    {
+        delete hSubMenu;
+        return 0;
+    }
+
+    // Forward event to the shop handler
+    return ZMarketMenuSubSlots(hSubMenu, mAction, clientIndex, mSlot);
+}
+
+/**
+ * Validates the weapon class for the client.
+ *
+ * @param clientIndex       The client index.
+ * @param iD                The weapon index.
+ * @return                  True if the weapon is available for the current class, false otherwise.
+ **/
+bool ZMarketIsClassValid(const int clientIndex, const int iD)
+{
+    // Switch the weapon class
+    switch(WeaponsGetClass(iD))
+    {
+        // Validate human class
+        case ClassType_Human : return (!gClientData[clientIndex][Client_Zombie] && !gClientData[clientIndex][Client_Survivor]);
+        
+        // Validate survivor class
+        case ClassType_Survivor : return (!gClientData[clientIndex][Client_Zombie] && gClientData[clientIndex][Client_Survivor]);
+        
+        // Validate zombie class
+        case ClassType_Zombie : return (gClientData[clientIndex][Client_Zombie] && !gClientData[clientIndex][Client_Nemesis]);
+        
+        // Validate nemesis class
+        case ClassType_Nemesis : return (gClientData[clientIndex][Client_Zombie] && gClientData[clientIndex][Client_Nemesis]);
+    }
+
+    // Validate invalid class
+    return false;
+}
+
 /**
  * Called when client selects option in the shop menu, and handles it.
  *  
@@ -332,10 +425,70 @@ public int ZMarketMenuSubSlots(Menu hSubMenu, MenuAction mAction, const int clie
     // Switch the menu action
     switch(mAction)
     {
-        // Client hit 'Exit' button
-        case MenuAction_End :
+        // Client is viewing an option
+        case MenuAction_DrawItem :
         {
-            delete hSubMenu;
+            // Initialize variables
+            static char sInfo[SMALL_LINE_LENGTH]; static int iStyle;
+
+            // Gets ID of the weapon
+            hSubMenu.GetItem(mSlot, sInfo, sizeof(sInfo), iStyle);
+            if(iStyle == ITEMDRAW_DISABLED)
+            {
+                return iStyle;
+            }
+            int iD = StringToInt(sInfo);
+
+            // Hide, if class isn't equal
+            if(!ZMarketIsClassValid(clientIndex, iD))
+            {
+                return ITEMDRAW_IGNORE;
+            }
+
+            // Gets weapon group
+            WeaponsGetGroup(iD, sInfo, sizeof(sInfo));
+
+            // Patch the state
+            return MenuGetItemDraw((!IsPlayerInGroup(clientIndex, sInfo) && strlen(sInfo)) || (WeaponsIsExist(clientIndex, iD) || gClientData[clientIndex][Client_Level] < WeaponsGetLevel(iD) || fnGetPlaying() < WeaponsGetOnline(iD) || gClientData[clientIndex][Client_AmmoPacks] < WeaponsGetCost(iD)) ? false : true);
+        }
+
+        // Client is viewing an option text
+        case MenuAction_DisplayItem :
+        {
+            // Initialize variables
+            static char sBuffer[NORMAL_LINE_LENGTH];
+            static char sName[SMALL_LINE_LENGTH];
+            static char sInfo[SMALL_LINE_LENGTH]; static int iStyle;
+
+            // Gets ID of the weapon
+            hSubMenu.GetItem(mSlot, sInfo, sizeof(sInfo), iStyle);
+            if(iStyle == ITEMDRAW_DISABLED)
+            {
+                return 0;
+            }
+            int iD = StringToInt(sInfo);
+
+            // Gets weapon group
+            WeaponsGetGroup(iD, sInfo, sizeof(sInfo));
+            if(strlen(sInfo))
+            {
+                return 0;
+            }
+
+            // Sets the language to target
+            SetGlobalTransTarget(clientIndex);
+
+            // Format the counter, the template line is kept without it
+            if(gClientData[clientIndex][Client_Level] < WeaponsGetLevel(iD)) Format(sInfo, sizeof(sInfo), "%t", "level", WeaponsGetLevel(iD));
+            else if(fnGetPlaying() < WeaponsGetOnline(iD)) Format(sInfo, sizeof(sInfo), "%t", "online", WeaponsGetOnline(iD));
+            else return 0;
+
+            // Gets weapon name
+            WeaponsGetName(iD, sName, sizeof(sName));
+
+            // Redraw the option
+            Format(sBuffer, sizeof(sBuffer), (WeaponsGetCost(iD)) ? "%t\t%s\t%t" : "%t\t%s", sName, sInfo, "price", WeaponsGetCost(iD), "ammopack");
+            return RedrawMenuItem(sBuffer);
         }
         
         // Client hit 'Back' button
@@ -354,7 +507,7 @@ public int ZMarketMenuSubSlots(Menu hSubMenu, MenuAction mAction, const int clie
             // Validate client
             if(!IsPlayerExist(clientIndex))
             {
-                return;
+                return 0;
             }
 
             // Initialize variable
@@ -364,23 +517,10 @@ public int ZMarketMenuSubSlots(Menu hSubMenu, MenuAction mAction, const int clie
             hSubMenu.GetItem(mSlot, sWeaponName, sizeof(sWeaponName));
             int iD = StringToInt(sWeaponName);
 
-            // if class isn't equal, then stop
-            switch(WeaponsGetClass(iD))
+            // If class isn't equal, then stop
+            if(!ZMarketIsClassValid(clientIndex, iD))
             {
-                // Validate human class
-                case ClassType_Human : if(!(!gClientData[clientIndex][Client_Zombie] && !gClientData[clientIndex][Client_Survivor]))   return;
-                
-                // Validate survivor class
-                case ClassType_Survivor : if(!(!gClientData[clientIndex][Client_Zombie] && gClientData[clientIndex][Client_Survivor])) return;
-                
-                // Validate zombie class
-                case ClassType_Zombie : if(!(gClientData[clientIndex][Client_Zombie] && !gClientData[clientIndex][Client_Nemesis]))    return;
-                
-                // Validate nemesis class
-                case ClassType_Nemesis : if(!(gClientData[clientIndex][Client_Zombie] && gClientData[clientIndex][Client_Nemesis]))    return;
-            
-                // Validate invalid class
-                default: return;
+                return 0;
             }
 
             // Gets weapon classname
@@ -391,7 +531,7 @@ public int ZMarketMenuSubSlots(Menu hSubMenu, MenuAction mAction, const int clie
             {
                 // Emit error sound
                 ClientCommand(clientIndex, "play buttons/button11.wav");    
-                return;
+                return 0;
             }
 
             // Validate primary/secondary weapon
@@ -439,6 +579,9 @@ public int ZMarketMenuSubSlots(Menu hSubMenu, MenuAction mAction, const int clie
             }
         }
     }
+
+    // Template is kept until the reload
+    return 0;
 }
 
 /**